@@ -0,0 +1,73 @@
+/*
+ * tm_api.h
+ *
+ * Thread-Metric 스타일 RTOS 벤치마크 API.
+ * 각 테스트(tm_*_test.c)는 tm_main()만 정의하고, 커널 의존 부분은
+ * 모두 tm_porting_layer.c 에서 이 커널 API로 매핑한다.
+ * 테스트 하나당 펌웨어 하나 (CMake 타깃 RTOS_TM_<test>).
+ */
+
+#ifndef TM_API_H
+#define TM_API_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TM_SUCCESS              0
+#define TM_ERROR                1
+
+/* 리포트 주기 (초). 각 리포트는 이 구간 동안의 처리 횟수를 출력 */
+#ifndef TM_TEST_DURATION
+#define TM_TEST_DURATION        30
+#endif
+
+/* 리포트 횟수. 0이면 무한 반복 */
+#ifndef TM_TEST_CYCLES
+#define TM_TEST_CYCLES          0
+#endif
+
+#define TM_MAX_THREADS          10
+#define TM_MAX_QUEUES           1
+#define TM_MAX_SEMAPHORES       1
+#define TM_MAX_MEMORY_POOLS     1
+
+/* 우선순위: 커널과 동일하게 숫자가 작을수록 높음 (0 ~ MAX_PRIORITY_LEVELS-2) */
+int  tm_initialize(void (*test_initialization_function)(void));
+int  tm_thread_create(int thread_id, int priority, void (*entry_function)(void));
+int  tm_thread_resume(int thread_id);
+int  tm_thread_suspend(int thread_id);
+void tm_thread_relinquish(void);
+void tm_thread_sleep(int seconds);
+
+/* 메시지는 16바이트 (unsigned long 4개) */
+int  tm_queue_create(int queue_id);
+int  tm_queue_send(int queue_id, unsigned long *message_ptr);
+int  tm_queue_receive(int queue_id, unsigned long *message_ptr);
+
+int  tm_semaphore_create(int semaphore_id);
+int  tm_semaphore_get(int semaphore_id);
+int  tm_semaphore_put(int semaphore_id);
+
+/* 128바이트 블록 풀 */
+int  tm_memory_pool_create(int pool_id);
+int  tm_memory_pool_allocate(int pool_id, unsigned char **memory_ptr);
+int  tm_memory_pool_deallocate(int pool_id, unsigned char *memory_ptr);
+
+/* 소프트웨어로 인터럽트를 발생시켜 tm_interrupt_handler()를 ISR 문맥에서 실행 */
+void tm_cause_interrupt(void);
+void tm_interrupt_handler(void);
+
+/* 테스트가 정의하는 진입점 */
+void tm_main(void);
+
+/* 리포트 출력 (UART + RTT) */
+void tm_report(const char *test_name, unsigned long relative_time,
+               unsigned long period_total);
+void tm_check_fail(const char *message);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,87 @@
+/*
+ * tm_budget_test.c
+ *
+ * 멈추지 않는 태스크(우선순위 1)에 실행 예산을 걸었을 때 아래 우선순위(2) 태스크가 받는 CPU.
+ *
+ *   BUDGET action=<none|demote|suspend> budget_us=<us> period=<tick> hog=<permille> low=<permille>
+ *          exhaustions=<n>
+ *
+ *   hog/low: 측정 구간 동안 두 태스크가 돈 루프 횟수의 비율
+ *   none은 예산 없음(low가 0), demote/suspend는 hog가 약 budget/period 근처
+ *   (소진 검사는 틱 단위라 주기당 최대 1틱까지 넘칠 수 있음)
+ */
+
+#include <stdio.h>
+
+#include "main.h"
+#include "scheduler.h"
+#include "task.h"
+#include "tm_api.h"
+
+#if !SCHEDULER_BUDGET
+#error "build with SCHEDULER_BUDGET=1"
+#endif
+
+#define BUDGET_BENCH_US         2000
+#define BUDGET_BENCH_PERIOD     10      // 틱
+
+static volatile uint32_t hogCount;
+static volatile uint32_t lowCount;
+
+static TCB_t tcb_hog;
+static TCB_t tcb_low;
+static TCB_t tcb_main;
+static uint32_t stack_hog[256];
+static uint32_t stack_low[256];
+static uint32_t stack_main[512];
+
+static void BudgetBench_SpinFunc(void *params)
+{
+    volatile uint32_t *count = (volatile uint32_t *)params;
+
+    while (1) {
+        (*count)++;
+    }
+}
+
+static void BudgetBench_Round(const char *name, uint32_t budgetUs, TaskBudgetAction_t action)
+{
+    uint32_t hog, low, total;
+
+    Task_SetBudget(&tcb_hog, budgetUs, (budgetUs != 0) ? BUDGET_BENCH_PERIOD : 0, action);
+    tcb_hog.budgetExhaustions = 0;
+    hogCount = 0;
+    lowCount = 0;
+
+    Task_Delay(TM_TEST_DURATION * SYSTICK_FREQ_HZ);
+
+    hog = hogCount;
+    low = lowCount;
+    total = (hog + low != 0) ? hog + low : 1;
+    printf("BUDGET action=%s budget_us=%u period=%u hog=%lu low=%lu exhaustions=%lu\r\n",
+           name, (unsigned)budgetUs, (unsigned)BUDGET_BENCH_PERIOD,
+           (unsigned long)((uint64_t)hog * 1000U / total),
+           (unsigned long)((uint64_t)low * 1000U / total),
+           (unsigned long)tcb_hog.budgetExhaustions);
+}
+
+static void BudgetBench_MainFunc(void *params)
+{
+    (void)params;
+
+    while (1) {
+        BudgetBench_Round("none", 0, TASK_BUDGET_DEMOTE);
+        BudgetBench_Round("demote", BUDGET_BENCH_US, TASK_BUDGET_DEMOTE);
+        BudgetBench_Round("suspend", BUDGET_BENCH_US, TASK_BUDGET_SUSPEND);
+    }
+}
+
+void tm_main(void)
+{
+    Task_CreateStatic(&tcb_hog, stack_hog, sizeof(stack_hog),
+                      BudgetBench_SpinFunc, "BudgetHog", (void *)&hogCount, 1, 0);
+    Task_CreateStatic(&tcb_low, stack_low, sizeof(stack_low),
+                      BudgetBench_SpinFunc, "BudgetLow", (void *)&lowCount, 2, 0);
+    Task_CreateStatic(&tcb_main, stack_main, sizeof(stack_main),
+                      BudgetBench_MainFunc, "BudgetMain", NULL, 0, 0);
+}
@@ -0,0 +1,73 @@
+/*
+ * tm_cooperative_scheduling_test.c
+ *
+ * 같은 우선순위의 스레드 5개가 카운터를 올리고 tm_thread_relinquish()로
+ * 양보한다. 구간당 전체 양보(컨텍스트 스위치) 횟수를 측정.
+ */
+
+#include "tm_api.h"
+
+#define TM_COOP_THREADS         5
+
+static volatile unsigned long tm_cooperative_thread_counter[TM_COOP_THREADS];
+
+static void tm_cooperative_thread_entry(int index)
+{
+    while (1) {
+        tm_cooperative_thread_counter[index]++;
+        tm_thread_relinquish();
+    }
+}
+
+static void tm_cooperative_thread_0_entry(void) { tm_cooperative_thread_entry(0); }
+static void tm_cooperative_thread_1_entry(void) { tm_cooperative_thread_entry(1); }
+static void tm_cooperative_thread_2_entry(void) { tm_cooperative_thread_entry(2); }
+static void tm_cooperative_thread_3_entry(void) { tm_cooperative_thread_entry(3); }
+static void tm_cooperative_thread_4_entry(void) { tm_cooperative_thread_entry(4); }
+
+static void tm_cooperative_thread_report(void)
+{
+    unsigned long last_total = 0;
+    unsigned long relative_time = 0;
+    unsigned long cycles = 0;
+
+    while (TM_TEST_CYCLES == 0 || cycles++ < TM_TEST_CYCLES) {
+        unsigned long total = 0;
+        unsigned long average;
+
+        tm_thread_sleep(TM_TEST_DURATION);
+        relative_time += TM_TEST_DURATION;
+
+        for (int i = 0; i < TM_COOP_THREADS; i++) {
+            total += tm_cooperative_thread_counter[i];
+        }
+
+        // 라운드 로빈이 공정하면 모든 카운터가 평균 +-1 안에 있어야 함
+        average = total / TM_COOP_THREADS;
+        for (int i = 0; i < TM_COOP_THREADS; i++) {
+            if (tm_cooperative_thread_counter[i] + 1 < average
+                || tm_cooperative_thread_counter[i] > average + 1) {
+                tm_check_fail("ERROR: Invalid counter value(s). Cooperative counters should not be more that 1 different than the average!\r\n");
+            }
+        }
+
+        tm_report("Cooperative Scheduling", relative_time, total - last_total);
+        last_total = total;
+    }
+}
+
+void tm_main(void)
+{
+    tm_thread_create(0, 3, tm_cooperative_thread_0_entry);
+    tm_thread_create(1, 3, tm_cooperative_thread_1_entry);
+    tm_thread_create(2, 3, tm_cooperative_thread_2_entry);
+    tm_thread_create(3, 3, tm_cooperative_thread_3_entry);
+    tm_thread_create(4, 3, tm_cooperative_thread_4_entry);
+
+    for (int i = 0; i < TM_COOP_THREADS; i++) {
+        tm_thread_resume(i);
+    }
+
+    tm_thread_create(5, 0, tm_cooperative_thread_report);
+    tm_thread_resume(5);
+}
@@ -0,0 +1,127 @@
+/*
+ * tm_coro_switch_test.cpp
+ *
+ * 코루틴(coro.hpp) 사이 전환과 커널 태스크 사이 전환의 비용 비교.
+ *
+ *   CORO flows=<n> coro_switch=<cyc> task_switch=<cyc> ram_coro=<B> ram_task=<B>
+ *
+ *   coro_switch: co::Semaphore 핑퐁 한 번 전환 평균 (같은 Executor 안, 스택 전환 없음)
+ *   task_switch: Semaphore_t 핑퐁 한 번 전환 평균 (PendSV 컨텍스트 스위치)
+ *   ram_coro/task: 흐름 하나당 바이트 (코루틴 프레임 블록 / TCB + 스택)
+ *
+ * 측정 중에도 CORO_BENCH_FLOWS개의 코루틴이 같은 Executor에서 대기하고 있다.
+ */
+
+#include <stdio.h>
+
+#include "main.h"
+#include "scheduler.h"
+#include "task.h"
+#include "semaphore.h"
+#include "coro.hpp"
+#include "rtos.hpp"
+#include "tm_api.h"
+
+#ifndef CORO_BENCH_FLOWS
+#define CORO_BENCH_FLOWS        16
+#endif
+
+#ifndef CORO_BENCH_ROUNDS
+#define CORO_BENCH_ROUNDS       1000
+#endif
+
+static co::Executor executor;
+static co::Semaphore coroPing;
+static co::Semaphore coroPong;
+static co::Semaphore coroIdle;
+
+static Semaphore_t taskPing;
+static Semaphore_t taskPong;
+static Semaphore_t doneSem;
+
+static volatile uint32_t coroCycles;
+
+static rtos::StaticTask<256> executorTask;
+static rtos::StaticTask<512> mainTask;
+static rtos::StaticTask<128> pongTask;
+
+static co::Task CoroBench_Idle()
+{
+    co_await coroIdle;
+}
+
+static co::Task CoroBench_Pong()
+{
+    while (1) {
+        co_await coroPing;
+        coroPong.signal();
+    }
+}
+
+static co::Task CoroBench_Ping()
+{
+    uint32_t start = DWT->CYCCNT;
+
+    for (uint32_t i = 0; i < CORO_BENCH_ROUNDS; i++) {
+        coroPing.signal();
+        co_await coroPong;
+    }
+    coroCycles = DWT->CYCCNT - start;
+    Semaphore_Signal(&doneSem);
+}
+
+static void CoroBench_PongFunc(void *params)
+{
+    (void)params;
+
+    while (1) {
+        Semaphore_Wait(&taskPing, TASK_WAIT_FOREVER);
+        Semaphore_Signal(&taskPong);
+    }
+}
+
+static void CoroBench_MainFunc(void *params)
+{
+    uint32_t start, coroAvg, taskAvg;
+    (void)params;
+
+    CoreDebug->DEMCR = CoreDebug->DEMCR | CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL = DWT->CTRL | DWT_CTRL_CYCCNTENA_Msk;
+
+    for (uint32_t i = 0; i < CORO_BENCH_FLOWS; i++) {
+        if (!executor.spawn(CoroBench_Idle())) {
+            tm_check_fail("coro frame pool exhausted");
+        }
+    }
+    executor.spawn(CoroBench_Pong());
+
+    while (1) {
+        executor.spawn(CoroBench_Ping());
+        Semaphore_Wait(&doneSem, TASK_WAIT_FOREVER);
+        coroAvg = coroCycles / (CORO_BENCH_ROUNDS * 2);
+
+        start = DWT->CYCCNT;
+        for (uint32_t i = 0; i < CORO_BENCH_ROUNDS; i++) {
+            Semaphore_Signal(&taskPing);
+            Semaphore_Wait(&taskPong, TASK_WAIT_FOREVER);
+        }
+        taskAvg = (DWT->CYCCNT - start) / (CORO_BENCH_ROUNDS * 2);
+
+        printf("CORO flows=%u coro_switch=%lu task_switch=%lu ram_coro=%u ram_task=%u\r\n",
+               (unsigned)CORO_BENCH_FLOWS, (unsigned long)coroAvg, (unsigned long)taskAvg,
+               (unsigned)CORO_FRAME_SIZE, (unsigned)sizeof(pongTask));
+
+        Task_Delay(TM_TEST_DURATION * SYSTICK_FREQ_HZ);
+    }
+}
+
+void tm_main(void)
+{
+    Semaphore_Init(&taskPing, 0);
+    Semaphore_Init(&taskPong, 0);
+    Semaphore_Init(&doneSem, 0);
+
+    executorTask.start(co::Executor::taskEntry, "CoroExec", &executor, 0);
+    pongTask.start(CoroBench_PongFunc, "CoroPong", NULL, 0);
+    mainTask.start(CoroBench_MainFunc, "CoroMain", NULL, 1);
+}
@@ -0,0 +1,152 @@
+/*
+ * tm_edf_schedule_test.c
+ *
+ * RM으로는 스케줄 불가능하고 EDF로는 가능한 주기 태스크 두 개를 동시에 릴리스해서
+ * 데드라인 미스를 센다. 같은 파일을 두 번 빌드:
+ *   RTOS_TM_edf_schedule      SCHEDULER_EDF=0, 주기가 짧은 A가 높은 우선순위 (RM)
+ *   RTOS_TM_edf_schedule_edf  SCHEDULER_EDF=1, A/B 모두 EDF 레벨
+ *
+ *   EDF policy=<rm|edf> util=<permille> jobs_a=<n> jobs_b=<n> misses_a=<n> misses_b=<n>
+ *
+ *   A: 주기 5틱, 작업 2.5 ms / B: 주기 7틱, 작업 3.2 ms -> 이용률 약 0.957
+ *   RM 한계(n=2)는 0.828이고, 동시 릴리스 직후 B의 첫 잡이 7틱 안에 끝나지 못함.
+ *   기대값: rm은 misses_b > 0, edf는 둘 다 0
+ */
+
+#include <stdio.h>
+
+#include "main.h"
+#include "scheduler.h"
+#include "task.h"
+#include "semaphore.h"
+#include "tm_api.h"
+
+#define EDF_BENCH_A_PERIOD      5       // 틱
+#define EDF_BENCH_A_WORK_US     2500
+#define EDF_BENCH_B_PERIOD      7
+#define EDF_BENCH_B_WORK_US     3200
+
+/* 측정 구간: 하이퍼피리어드(35틱)의 배수 */
+#ifndef EDF_BENCH_TICKS
+#define EDF_BENCH_TICKS         (35 * 40)
+#endif
+
+#if SCHEDULER_EDF
+#define EDF_BENCH_POLICY        "edf"
+#define EDF_BENCH_A_PRIORITY    SCHEDULER_EDF_PRIORITY
+#define EDF_BENCH_B_PRIORITY    SCHEDULER_EDF_PRIORITY
+#else
+#define EDF_BENCH_POLICY        "rm"
+#define EDF_BENCH_A_PRIORITY    0
+#define EDF_BENCH_B_PRIORITY    1
+#endif
+
+/* 두 주기 태스크보다 낮은 백그라운드 레벨 */
+#define EDF_BENCH_MAIN_PRIORITY 2
+
+typedef struct {
+    Semaphore_t start;
+    uint32_t workUs;
+    volatile uint32_t jobs;
+} EdfBenchJob_t;
+
+static EdfBenchJob_t jobA = { .workUs = EDF_BENCH_A_WORK_US };
+static EdfBenchJob_t jobB = { .workUs = EDF_BENCH_B_WORK_US };
+
+static Semaphore_t doneSem;
+static volatile uint8_t running;
+static uint32_t loopsPerMs;
+
+static TCB_t tcb_a;
+static TCB_t tcb_b;
+static TCB_t tcb_main;
+static uint32_t stack_a[256];
+static uint32_t stack_b[256];
+static uint32_t stack_main[512];
+
+/* 선점당해도 늘어나지 않도록 벽시계가 아닌 반복 횟수로 작업량을 정함 */
+static void EdfBench_Spin(uint32_t loops)
+{
+    for (volatile uint32_t i = 0; i < loops; i++);
+}
+
+static void EdfBench_Calibrate(void)
+{
+    uint32_t start = DWT->CYCCNT;
+    uint32_t cycles;
+
+    EdfBench_Spin(10000);
+    cycles = DWT->CYCCNT - start;
+    loopsPerMs = (uint32_t)(10000ULL * (SystemCoreClock / 1000U) / cycles);
+}
+
+static void EdfBench_JobFunc(void *params)
+{
+    EdfBenchJob_t *job = (EdfBenchJob_t *)params;
+
+    while (1) {
+        Semaphore_Wait(&job->start, TASK_WAIT_FOREVER);
+
+        while (running) {
+            EdfBench_Spin(job->workUs * loopsPerMs / 1000U);
+            job->jobs++;
+            Task_WaitForNextPeriod();
+        }
+        Semaphore_Signal(&doneSem);
+    }
+}
+
+static void EdfBench_MainFunc(void *params)
+{
+    uint32_t util;
+    (void)params;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    EdfBench_Calibrate();
+    util = EDF_BENCH_A_WORK_US / EDF_BENCH_A_PERIOD + EDF_BENCH_B_WORK_US / EDF_BENCH_B_PERIOD;
+
+    while (1) {
+        jobA.jobs = 0;
+        jobB.jobs = 0;
+        tcb_a.deadlineMisses = 0;
+        tcb_b.deadlineMisses = 0;
+
+        // 틱 경계에 맞춘 뒤 같은 틱에 두 태스크를 릴리스 (임계 시점)
+        Task_Delay(1);
+        running = 1;
+        Task_SetPeriod(&tcb_a, EDF_BENCH_A_PERIOD, 0);
+        Task_SetPeriod(&tcb_b, EDF_BENCH_B_PERIOD, 0);
+        Semaphore_Signal(&jobA.start);
+        Semaphore_Signal(&jobB.start);
+
+        Task_Delay(EDF_BENCH_TICKS);
+        running = 0;
+        Semaphore_Wait(&doneSem, TASK_WAIT_FOREVER);
+        Semaphore_Wait(&doneSem, TASK_WAIT_FOREVER);
+        Task_SetPeriod(&tcb_a, 0, 0);
+        Task_SetPeriod(&tcb_b, 0, 0);
+
+        printf("EDF policy=%s util=%lu jobs_a=%lu jobs_b=%lu misses_a=%lu misses_b=%lu\r\n",
+               EDF_BENCH_POLICY, (unsigned long)util,
+               (unsigned long)jobA.jobs, (unsigned long)jobB.jobs,
+               (unsigned long)tcb_a.deadlineMisses, (unsigned long)tcb_b.deadlineMisses);
+
+        Task_Delay(TM_TEST_DURATION * SYSTICK_FREQ_HZ);
+    }
+}
+
+void tm_main(void)
+{
+    Semaphore_Init(&jobA.start, 0);
+    Semaphore_Init(&jobB.start, 0);
+    Semaphore_Init(&doneSem, 0);
+
+    Task_CreateStatic(&tcb_a, stack_a, sizeof(stack_a),
+                      EdfBench_JobFunc, "EdfA", &jobA, EDF_BENCH_A_PRIORITY, 0);
+    Task_CreateStatic(&tcb_b, stack_b, sizeof(stack_b),
+                      EdfBench_JobFunc, "EdfB", &jobB, EDF_BENCH_B_PRIORITY, 0);
+    Task_CreateStatic(&tcb_main, stack_main, sizeof(stack_main),
+                      EdfBench_MainFunc, "EdfMain", NULL, EDF_BENCH_MAIN_PRIORITY, 0);
+}
@@ -0,0 +1,131 @@
+/*
+ * tm_fair_share_test.c
+ *
+ * SCHEDULER_FAIR 레벨에서 가중치 70/30인 두 CPU 바운드 태스크의 실제 CPU 몫.
+ *
+ *   FAIR weights=<a>/<b> share_a=<permille> share_b=<permille>
+ *   FAIR_PICK ready=<n> cyc=<cyc>      (n = 2, 4, 8, 16)
+ *
+ *   share: 측정 구간 동안 각 태스크가 돈 루프 횟수의 비율 (가중치 비율과 같아야 함)
+ *   pick:  공정 분배 레벨이 가장 높은 레디 레벨일 때 Scheduler_GetHighestPriorityTask 한 번의
+ *          평균 사이클. 레벨 안의 선택은 힙 루트라 O(1)이지만, 그 레벨을 찾는 태스크 리스트
+ *          스캔이 O(n)이라 전체 태스크 수에 비례해 늘어남
+ *
+ * pick 측정 때는 쉬게 해 둔 공정 레벨 태스크를 재개해 레디 수를 늘리고, 측정 태스크 자신은
+ * 인터럽트를 끈 채 잠깐 BLOCKED로 표시해 스캔에서 빠진다 (재개된 태스크는 실제로 돌지 않음).
+ */
+
+#include <stdio.h>
+
+#include "main.h"
+#include "scheduler.h"
+#include "task.h"
+#include "tm_api.h"
+
+#if !SCHEDULER_FAIR
+#error "build with SCHEDULER_FAIR=1"
+#endif
+
+#define FAIR_BENCH_WEIGHT_A     70
+#define FAIR_BENCH_WEIGHT_B     30
+
+/* pick 측정용으로 더 띄우는 공정 레벨 태스크 (A, B와 합쳐 최대 SCHEDULER_FAIR_MAX_TASKS) */
+#define FAIR_BENCH_EXTRA        (SCHEDULER_FAIR_MAX_TASKS - 2)
+#define FAIR_BENCH_PICK_REPEAT  16
+
+static volatile uint32_t countA;
+static volatile uint32_t countB;
+static volatile uint32_t countExtra;
+
+static TCB_t tcb_a;
+static TCB_t tcb_b;
+static TCB_t tcb_main;
+static TCB_t tcb_extra[FAIR_BENCH_EXTRA];
+static uint32_t stack_a[256];
+static uint32_t stack_b[256];
+static uint32_t stack_main[512];
+static uint32_t stack_extra[FAIR_BENCH_EXTRA][128];
+
+static void FairBench_SpinFunc(void *params)
+{
+    volatile uint32_t *count = (volatile uint32_t *)params;
+
+    while (1) {
+        (*count)++;
+    }
+}
+
+/* 레디 공정 태스크가 ready개일 때 공정 레벨 선택 비용 (평균 사이클) */
+static uint32_t FairBench_MeasurePick(uint32_t ready)
+{
+    uint32_t start, total;
+
+    for (uint32_t i = 0; i + 2 < ready; i++) {
+        Task_Resume(&tcb_extra[i]);
+    }
+
+    __disable_irq();
+    // 자기 자신(더 높은 레벨)이 스캔에 잡히지 않도록. 인터럽트가 꺼져 있어 스위치는 없음
+    currentTask->state = TASK_STATE_BLOCKED;
+    start = DWT->CYCCNT;
+    for (uint32_t i = 0; i < FAIR_BENCH_PICK_REPEAT; i++) {
+        (void)Scheduler_GetHighestPriorityTask();
+    }
+    total = DWT->CYCCNT - start;
+    currentTask->state = TASK_STATE_RUNNING;
+    __enable_irq();
+
+    for (uint32_t i = 0; i + 2 < ready; i++) {
+        Task_Suspend(&tcb_extra[i]);
+    }
+    return total / FAIR_BENCH_PICK_REPEAT;
+}
+
+static void FairBench_MainFunc(void *params)
+{
+    uint32_t a, b;
+    (void)params;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    while (1) {
+        countA = 0;
+        countB = 0;
+        Task_Delay(TM_TEST_DURATION * SYSTICK_FREQ_HZ);
+        a = countA;
+        b = countB;
+
+        printf("FAIR weights=%u/%u share_a=%lu share_b=%lu\r\n",
+               (unsigned)FAIR_BENCH_WEIGHT_A, (unsigned)FAIR_BENCH_WEIGHT_B,
+               (unsigned long)((uint64_t)a * 1000U / (a + b)),
+               (unsigned long)((uint64_t)b * 1000U / (a + b)));
+
+        for (uint32_t ready = 2; ready <= FAIR_BENCH_EXTRA + 2; ready *= 2) {
+            printf("FAIR_PICK ready=%lu cyc=%lu\r\n",
+                   (unsigned long)ready, (unsigned long)FairBench_MeasurePick(ready));
+        }
+    }
+}
+
+void tm_main(void)
+{
+    Task_CreateStatic(&tcb_a, stack_a, sizeof(stack_a),
+                      FairBench_SpinFunc, "FairA", (void *)&countA, SCHEDULER_FAIR_PRIORITY, 1);
+    Task_CreateStatic(&tcb_b, stack_b, sizeof(stack_b),
+                      FairBench_SpinFunc, "FairB", (void *)&countB, SCHEDULER_FAIR_PRIORITY, 1);
+    Task_SetWeight(&tcb_a, FAIR_BENCH_WEIGHT_A);
+    Task_SetWeight(&tcb_b, FAIR_BENCH_WEIGHT_B);
+
+    // pick 측정 때만 재개. 측정 태스크가 위에서 CPU를 쥐고 있어 실제로 돌지는 않음
+    for (uint32_t i = 0; i < FAIR_BENCH_EXTRA; i++) {
+        Task_CreateStatic(&tcb_extra[i], stack_extra[i], sizeof(stack_extra[i]),
+                          FairBench_SpinFunc, "FairX", (void *)&countExtra,
+                          SCHEDULER_FAIR_PRIORITY, 1);
+        Task_Suspend(&tcb_extra[i]);
+    }
+
+    // 측정 태스크는 더 높은 우선순위에서 잠들어 있음
+    Task_CreateStatic(&tcb_main, stack_main, sizeof(stack_main),
+                      FairBench_MainFunc, "FairMain", NULL, SCHEDULER_FAIR_PRIORITY - 1, 0);
+}
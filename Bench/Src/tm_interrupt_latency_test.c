@@ -0,0 +1,287 @@
+/*
+ * tm_interrupt_latency_test.c
+ *
+ * 하드웨어 인터럽트(TIM2 업데이트) 발생 시점부터 깨어난 태스크의 첫 명령까지의
+ * 지연을 DWT 사이클로 측정한다. 배경 부하를 단계별로 바꿔가며
+ * min/avg/max 와 log2 히스토그램을 한 줄로 출력 (커밋별 비교용).
+ *
+ *   LAT <phase> n=<샘플> min=<cyc> avg=<cyc> max=<cyc> h=<b0>,<b1>,...
+ *   b0: <64 사이클, bN: [32<<N, 64<<N) 사이클, 마지막 버킷은 그 이상 전부
+ *
+ * 측정 방법: TIM2는 업데이트 이벤트 시점에 CNT=0 에서 다시 센다. ISR 진입 시
+ * CYCCNT 에서 (CNT * 코어/타이머 클럭비)를 빼면 이벤트 시점의 CYCCNT가 된다.
+ */
+
+#include <stdio.h>
+
+#include "main.h"
+#include "scheduler.h"
+#include "task.h"
+#include "semaphore.h"
+#include "tm_api.h"
+
+/* 측정 인터럽트로 TIM2를 직접 쓰므로 기본 슬라이스 만료 타이머와 충돌 */
+#if SCHEDULER_SLICE_CYCLES && defined(SCHEDULER_SLICE_TIMER_IS_TIM2)
+#error "tm_interrupt_latency uses TIM2; build without SCHEDULER_SLICE_CYCLES or move SCHEDULER_SLICE_TIMER"
+#endif
+
+/* 단계당 측정 시간 (초) */
+#ifndef LATENCY_PHASE_SECONDS
+#define LATENCY_PHASE_SECONDS   5
+#endif
+
+/* 인터럽트 주기 (us). SysTick과 위상이 계속 바뀌도록 1ms의 배수를 피함 */
+#ifndef LATENCY_PERIOD_US
+#define LATENCY_PERIOD_US       997
+#endif
+
+#define LATENCY_BUCKETS         12
+#define LATENCY_SLEEPERS        8
+#define LATENCY_HOGS            2
+
+typedef enum {
+    LATENCY_PHASE_IDLE = 0,
+    LATENCY_PHASE_CPU_HOG,
+    LATENCY_PHASE_PRINTF,
+    LATENCY_PHASE_SLEEPERS,
+    LATENCY_PHASE_COUNT
+} LatencyPhase_t;
+
+static const char *const latencyPhaseName[LATENCY_PHASE_COUNT] = {
+    "idle", "cpu_hog", "printf", "sleepers"
+};
+
+typedef struct {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+    uint32_t hist[LATENCY_BUCKETS];
+} LatencyStats_t;
+
+static Semaphore_t latencySem;
+static volatile uint32_t latencyEventCycle;
+static uint32_t latencyTimerRatio;
+static volatile LatencyStats_t latencyStats;
+static volatile LatencyPhase_t latencyPhase = LATENCY_PHASE_IDLE;
+
+static TCB_t tcb_latency;
+static uint32_t stack_latency[256];
+static TCB_t tcb_report;
+static uint32_t stack_report[512];
+static TCB_t tcb_hog[LATENCY_HOGS];
+static uint32_t stack_hog[LATENCY_HOGS][128];
+static TCB_t tcb_printer;
+static uint32_t stack_printer[512];
+static TCB_t tcb_sleeper[LATENCY_SLEEPERS];
+static uint32_t stack_sleeper[LATENCY_SLEEPERS][128];
+
+static void Latency_Reset(void)
+{
+    __disable_irq();
+    latencyStats.count = 0;
+    latencyStats.min = 0xFFFFFFFFUL;
+    latencyStats.max = 0;
+    latencyStats.sum = 0;
+    for (int i = 0; i < LATENCY_BUCKETS; i++) {
+        latencyStats.hist[i] = 0;
+    }
+    __enable_irq();
+}
+
+static void Latency_Record(uint32_t cycles)
+{
+    uint32_t bucket = 32U - __CLZ(cycles >> 6);
+
+    if (bucket >= LATENCY_BUCKETS) {
+        bucket = LATENCY_BUCKETS - 1;
+    }
+
+    latencyStats.count++;
+    latencyStats.sum += cycles;
+    if (cycles < latencyStats.min) latencyStats.min = cycles;
+    if (cycles > latencyStats.max) latencyStats.max = cycles;
+    latencyStats.hist[bucket]++;
+}
+
+void TIM2_IRQHandler(void)
+{
+    uint32_t now = DWT->CYCCNT;
+    uint32_t elapsed = TIM2->CNT;
+
+    TIM2->SR = ~TIM_SR_UIF;
+    latencyEventCycle = now - elapsed * latencyTimerRatio;
+    Semaphore_Signal(&latencySem);
+}
+
+static void Latency_TimerInit(void)
+{
+    uint32_t pclk1 = HAL_RCC_GetPCLK1Freq();
+    uint32_t timerClock = pclk1;
+
+    // APB1 분주가 1이 아니면 타이머 클럭은 PCLK1 x2
+    if ((RCC->CFGR & RCC_CFGR_PPRE1) != RCC_CFGR_PPRE1_DIV1) {
+        timerClock = pclk1 * 2U;
+    }
+    latencyTimerRatio = SystemCoreClock / timerClock;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    RCC->APB1ENR |= RCC_APB1ENR_TIM2EN;
+    (void)RCC->APB1ENR;
+
+    TIM2->CR1 = 0;
+    TIM2->PSC = 0;
+    TIM2->ARR = (uint32_t)(((uint64_t)timerClock * LATENCY_PERIOD_US) / 1000000U) - 1U;
+    TIM2->CNT = 0;
+    TIM2->EGR = TIM_EGR_UG;
+    TIM2->SR = 0;
+    TIM2->DIER = TIM_DIER_UIE;
+
+    NVIC_SetPriority(TIM2_IRQn, 0x05);
+    NVIC_EnableIRQ(TIM2_IRQn);
+
+    TIM2->CR1 = TIM_CR1_CEN;
+}
+
+/* 측정 대상 - 가장 높은 우선순위의 작업 태스크 */
+static void Latency_TaskFunc(void *params)
+{
+    (void)params;
+
+    Latency_TimerInit();
+
+    while (1) {
+        Semaphore_Wait(&latencySem, TASK_WAIT_FOREVER);
+        Latency_Record(DWT->CYCCNT - latencyEventCycle);
+    }
+}
+
+/* 부하 태스크는 자기 단계가 아니면 안전한 지점에서 스스로 suspend */
+static void Latency_HogFunc(void *params)
+{
+    volatile int i;
+    (void)params;
+
+    while (1) {
+        if (latencyPhase != LATENCY_PHASE_CPU_HOG) {
+            Task_Suspend(currentTask);
+            continue;
+        }
+        for (i = 0; i < 500000; i++);
+    }
+}
+
+static void Latency_PrinterFunc(void *params)
+{
+    uint32_t line = 0;
+    (void)params;
+
+    while (1) {
+        if (latencyPhase != LATENCY_PHASE_PRINTF) {
+            Task_Suspend(currentTask);
+            continue;
+        }
+        printf("  [load] printf %lu %08lx %s\r\n", (unsigned long)line,
+               (unsigned long)(line * 2654435761UL), "padding padding padding");
+        line++;
+    }
+}
+
+static void Latency_SleeperFunc(void *params)
+{
+    uint32_t period = (uint32_t)(uintptr_t)params;
+
+    while (1) {
+        if (latencyPhase != LATENCY_PHASE_SLEEPERS) {
+            Task_Suspend(currentTask);
+            continue;
+        }
+        Task_Delay(period);
+    }
+}
+
+static void Latency_StartPhase(LatencyPhase_t phase)
+{
+    latencyPhase = phase;
+
+    switch (phase) {
+    case LATENCY_PHASE_CPU_HOG:
+        for (int i = 0; i < LATENCY_HOGS; i++) {
+            Task_Resume(&tcb_hog[i]);
+        }
+        break;
+    case LATENCY_PHASE_PRINTF:
+        Task_Resume(&tcb_printer);
+        break;
+    case LATENCY_PHASE_SLEEPERS:
+        for (int i = 0; i < LATENCY_SLEEPERS; i++) {
+            Task_Resume(&tcb_sleeper[i]);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+static void Latency_ReportFunc(void *params)
+{
+    LatencyStats_t snap;
+    (void)params;
+
+    while (1) {
+        for (int phase = 0; phase < LATENCY_PHASE_COUNT; phase++) {
+            Latency_Reset();
+            Latency_StartPhase((LatencyPhase_t)phase);
+            Task_Delay(LATENCY_PHASE_SECONDS * SYSTICK_FREQ_HZ);
+
+            // 부하 태스크들이 스스로 멈출 시간을 준 뒤 출력
+            latencyPhase = LATENCY_PHASE_IDLE;
+            __disable_irq();
+            snap = latencyStats;
+            __enable_irq();
+            Task_Delay(50);
+
+            printf("LAT %s n=%lu min=%lu avg=%lu max=%lu h=",
+                   latencyPhaseName[phase], (unsigned long)snap.count,
+                   (unsigned long)(snap.count ? snap.min : 0),
+                   (unsigned long)(snap.count ? snap.sum / snap.count : 0),
+                   (unsigned long)snap.max);
+            for (int i = 0; i < LATENCY_BUCKETS; i++) {
+                printf((i + 1 < LATENCY_BUCKETS) ? "%lu," : "%lu\r\n",
+                       (unsigned long)snap.hist[i]);
+            }
+        }
+    }
+}
+
+void tm_main(void)
+{
+    Semaphore_Init(&latencySem, 0);
+    Latency_Reset();
+
+    Task_CreateStatic(&tcb_report, stack_report, sizeof(stack_report),
+                      Latency_ReportFunc, "LatReport", NULL, 0, 0);
+    Task_CreateStatic(&tcb_latency, stack_latency, sizeof(stack_latency),
+                      Latency_TaskFunc, "Latency", NULL, 1, 0);
+
+    Task_CreateStatic(&tcb_printer, stack_printer, sizeof(stack_printer),
+                      Latency_PrinterFunc, "LatPrintf", NULL, 2, 0);
+    Task_Suspend(&tcb_printer);
+
+    // Task2/Task3 처럼 같은 우선순위에서 라운드 로빈하는 CPU 점유 태스크
+    for (int i = 0; i < LATENCY_HOGS; i++) {
+        Task_CreateStatic(&tcb_hog[i], stack_hog[i], sizeof(stack_hog[i]),
+                          Latency_HogFunc, "LatHog", NULL, 3, 10);
+        Task_Suspend(&tcb_hog[i]);
+    }
+
+    for (int i = 0; i < LATENCY_SLEEPERS; i++) {
+        Task_CreateStatic(&tcb_sleeper[i], stack_sleeper[i], sizeof(stack_sleeper[i]),
+                          Latency_SleeperFunc, "LatSleep", (void *)(uintptr_t)(1 + i % 3),
+                          4, 10);
+        Task_Suspend(&tcb_sleeper[i]);
+    }
+}
@@ -0,0 +1,77 @@
+/*
+ * tm_interrupt_preemption_processing_test.c
+ *
+ * 낮은 우선순위 스레드가 인터럽트를 발생시키고, ISR이 높은 우선순위
+ * 스레드를 resume 한다. 인터럽트 복귀 시점의 선점(ISR -> 다른 태스크)
+ * 경로를 측정.
+ */
+
+#include "tm_api.h"
+
+static volatile unsigned long tm_interrupt_preemption_thread_0_counter;
+static volatile unsigned long tm_interrupt_preemption_thread_1_counter;
+static volatile unsigned long tm_interrupt_preemption_handler_counter;
+
+static void tm_interrupt_preemption_thread_0_entry(void)
+{
+    while (1) {
+        tm_interrupt_preemption_thread_0_counter++;
+        tm_cause_interrupt();
+    }
+}
+
+static void tm_interrupt_preemption_thread_1_entry(void)
+{
+    while (1) {
+        tm_interrupt_preemption_thread_1_counter++;
+        tm_thread_suspend(1);
+    }
+}
+
+void tm_interrupt_handler(void)
+{
+    tm_interrupt_preemption_handler_counter++;
+    tm_thread_resume(1);
+}
+
+static void tm_interrupt_preemption_thread_report(void)
+{
+    unsigned long last_total = 0;
+    unsigned long relative_time = 0;
+    unsigned long cycles = 0;
+
+    while (TM_TEST_CYCLES == 0 || cycles++ < TM_TEST_CYCLES) {
+        unsigned long total;
+        unsigned long average;
+
+        tm_thread_sleep(TM_TEST_DURATION);
+        relative_time += TM_TEST_DURATION;
+
+        total = tm_interrupt_preemption_thread_0_counter
+              + tm_interrupt_preemption_thread_1_counter
+              + tm_interrupt_preemption_handler_counter;
+
+        average = total / 3;
+        if (tm_interrupt_preemption_thread_0_counter + 1 < average
+            || tm_interrupt_preemption_thread_0_counter > average + 1
+            || tm_interrupt_preemption_thread_1_counter + 1 < average
+            || tm_interrupt_preemption_thread_1_counter > average + 1
+            || tm_interrupt_preemption_handler_counter + 1 < average
+            || tm_interrupt_preemption_handler_counter > average + 1) {
+            tm_check_fail("ERROR: Invalid counter value(s). Interrupt preemption test has failed!\r\n");
+        }
+
+        tm_report("Interrupt Preemption Processing", relative_time, total - last_total);
+        last_total = total;
+    }
+}
+
+void tm_main(void)
+{
+    tm_thread_create(0, 6, tm_interrupt_preemption_thread_0_entry);
+    tm_thread_create(1, 5, tm_interrupt_preemption_thread_1_entry);
+    tm_thread_resume(0);
+
+    tm_thread_create(2, 0, tm_interrupt_preemption_thread_report);
+    tm_thread_resume(2);
+}
@@ -0,0 +1,69 @@
+/*
+ * tm_interrupt_processing_test.c
+ *
+ * 스레드가 소프트웨어 인터럽트를 발생시키고, ISR은 세마포어를 put,
+ * 스레드는 그 세마포어를 get 한다. 선점 없이 인터럽트 진입/복귀와
+ * ISR 에서의 커널 호출 비용을 측정.
+ */
+
+#include "tm_api.h"
+
+static volatile unsigned long tm_interrupt_thread_0_counter;
+static volatile unsigned long tm_interrupt_handler_counter;
+
+static void tm_interrupt_thread_0_entry(void)
+{
+    // 초기 토큰을 비워서 이후 get은 ISR이 put한 토큰만 받도록 함
+    tm_semaphore_get(0);
+
+    while (1) {
+        tm_cause_interrupt();
+
+        if (tm_semaphore_get(0) != TM_SUCCESS) {
+            break;
+        }
+
+        tm_interrupt_thread_0_counter++;
+    }
+}
+
+void tm_interrupt_handler(void)
+{
+    tm_interrupt_handler_counter++;
+    tm_semaphore_put(0);
+}
+
+static void tm_interrupt_thread_report(void)
+{
+    unsigned long last_total = 0;
+    unsigned long relative_time = 0;
+    unsigned long cycles = 0;
+
+    while (TM_TEST_CYCLES == 0 || cycles++ < TM_TEST_CYCLES) {
+        unsigned long total;
+
+        tm_thread_sleep(TM_TEST_DURATION);
+        relative_time += TM_TEST_DURATION;
+
+        total = tm_interrupt_thread_0_counter + tm_interrupt_handler_counter;
+
+        if (tm_interrupt_thread_0_counter + 1 < tm_interrupt_handler_counter
+            || tm_interrupt_thread_0_counter > tm_interrupt_handler_counter) {
+            tm_check_fail("ERROR: Invalid counter value(s). Interrupt processing test has failed!\r\n");
+        }
+
+        tm_report("Interrupt Processing", relative_time, total - last_total);
+        last_total = total;
+    }
+}
+
+void tm_main(void)
+{
+    tm_semaphore_create(0);
+
+    tm_thread_create(0, 6, tm_interrupt_thread_0_entry);
+    tm_thread_resume(0);
+
+    tm_thread_create(1, 0, tm_interrupt_thread_report);
+    tm_thread_resume(1);
+}
@@ -0,0 +1,59 @@
+/*
+ * tm_memory_allocation_test.c
+ *
+ * 한 스레드가 128바이트 블록을 할당하고 바로 해제한다.
+ * 구간당 allocate/deallocate 쌍의 횟수를 측정.
+ */
+
+#include "tm_api.h"
+
+static volatile unsigned long tm_memory_allocation_counter;
+
+static void tm_memory_allocation_thread_0_entry(void)
+{
+    unsigned char *memory_ptr;
+
+    while (1) {
+        if (tm_memory_pool_allocate(0, &memory_ptr) != TM_SUCCESS) {
+            break;
+        }
+        if (tm_memory_pool_deallocate(0, memory_ptr) != TM_SUCCESS) {
+            break;
+        }
+
+        tm_memory_allocation_counter++;
+    }
+}
+
+static void tm_memory_allocation_thread_report(void)
+{
+    unsigned long last_counter = 0;
+    unsigned long relative_time = 0;
+    unsigned long cycles = 0;
+
+    while (TM_TEST_CYCLES == 0 || cycles++ < TM_TEST_CYCLES) {
+        unsigned long counter;
+
+        tm_thread_sleep(TM_TEST_DURATION);
+        relative_time += TM_TEST_DURATION;
+
+        counter = tm_memory_allocation_counter;
+        if (counter == last_counter) {
+            tm_check_fail("ERROR: Invalid counter value(s). Error allocating/deallocating memory!\r\n");
+        }
+
+        tm_report("Memory Allocation", relative_time, counter - last_counter);
+        last_counter = counter;
+    }
+}
+
+void tm_main(void)
+{
+    tm_memory_pool_create(0);
+
+    tm_thread_create(0, 6, tm_memory_allocation_thread_0_entry);
+    tm_thread_resume(0);
+
+    tm_thread_create(1, 0, tm_memory_allocation_thread_report);
+    tm_thread_resume(1);
+}
@@ -0,0 +1,65 @@
+/*
+ * tm_message_processing_test.c
+ *
+ * 한 스레드가 16바이트 메시지를 큐에 보내고 바로 다시 받는다.
+ * 구간당 send/receive 쌍의 횟수를 측정.
+ */
+
+#include "tm_api.h"
+
+static volatile unsigned long tm_message_processing_counter;
+static unsigned long tm_message_sent[4];
+static unsigned long tm_message_received[4];
+
+static void tm_message_processing_thread_0_entry(void)
+{
+    tm_message_sent[0] = 0x11112222;
+    tm_message_sent[1] = 0x33334444;
+    tm_message_sent[2] = 0x55556666;
+    tm_message_sent[3] = 0x77778888;
+
+    while (1) {
+        tm_queue_send(0, tm_message_sent);
+        tm_queue_receive(0, tm_message_received);
+
+        if (tm_message_received[3] != tm_message_sent[3]) {
+            break;
+        }
+
+        tm_message_sent[3]++;
+        tm_message_processing_counter++;
+    }
+}
+
+static void tm_message_processing_thread_report(void)
+{
+    unsigned long last_counter = 0;
+    unsigned long relative_time = 0;
+    unsigned long cycles = 0;
+
+    while (TM_TEST_CYCLES == 0 || cycles++ < TM_TEST_CYCLES) {
+        unsigned long counter;
+
+        tm_thread_sleep(TM_TEST_DURATION);
+        relative_time += TM_TEST_DURATION;
+
+        counter = tm_message_processing_counter;
+        if (counter == last_counter) {
+            tm_check_fail("ERROR: Invalid counter value(s). Error sending/receiving messages!\r\n");
+        }
+
+        tm_report("Message Processing", relative_time, counter - last_counter);
+        last_counter = counter;
+    }
+}
+
+void tm_main(void)
+{
+    tm_queue_create(0);
+
+    tm_thread_create(0, 6, tm_message_processing_thread_0_entry);
+    tm_thread_resume(0);
+
+    tm_thread_create(1, 0, tm_message_processing_thread_report);
+    tm_thread_resume(1);
+}
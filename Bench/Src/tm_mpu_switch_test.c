@@ -0,0 +1,226 @@
+/*
+ * tm_mpu_switch_test.c
+ *
+ * 태스크별 MPU 도메인 리로드가 컨텍스트 스위치에 더하는 비용을 DWT 사이클로 측정.
+ * 두 태스크가 세마포어로 핑퐁(왕복 = 스위치 2회)하며, 도메인 배치만 바꿔 비교한다.
+ *
+ *   MPU <case> switch=<cyc> delta=<cyc>
+ *
+ *   none:   두 태스크 모두 도메인 없음 (리로드 없음, 기준값)
+ *   shared: 같은 도메인 공유 (포인터 비교 후 생략)
+ *   reload: 서로 다른 도메인 (스위치마다 영역 4개 로드)
+ *
+ * delta는 none 대비 스위치 1회당 추가 사이클. MPU_ENABLE=1 로 빌드 (CMake에서 지정).
+ *
+ * 시작할 때 한 번 격리 검사: 자기 스택만 도메인으로 가진 비특권 태스크가
+ *   1) Sys_ConsoleWrite/Sys_QueueSend로 정상 시스템 콜 (Flash 문자열, 스택 버퍼)
+ *   2) 커널 변수 주소를 버퍼로 넘긴 Sys_QueueReceive가 -1로 거부됨
+ *   3) 커널 변수에 직접 쓰면 MemManage: 그 태스크만 정지되고 변수는 그대로
+ *
+ *   MPU isolation syscall=<n> bad_ptr=<rc> fault=<contained|missed>
+ *
+ * 격리 태스크는 newlib(printf, errno, malloc)을 쓸 수 없음 (task.h Task_SetMpuDomain)
+ */
+
+#include <stdio.h>
+
+#include "main.h"
+#include "scheduler.h"
+#include "task.h"
+#include "semaphore.h"
+#include "queue.h"
+#include "svc.h"
+#include "mpu.h"
+#include "tm_api.h"
+
+#if !MPU_ENABLE
+#error "tm_mpu_switch_test requires MPU_ENABLE=1"
+#endif
+
+#ifndef MPU_BENCH_ROUNDS
+#define MPU_BENCH_ROUNDS        1000
+#endif
+
+#ifndef MPU_BENCH_PERIOD_SECONDS
+#define MPU_BENCH_PERIOD_SECONDS    5
+#endif
+
+#define MPU_BENCH_STACK_WORDS   256     // 1KB: 영역 크기 = 정렬
+
+typedef enum {
+    MPU_CASE_NONE = 0,
+    MPU_CASE_SHARED,
+    MPU_CASE_RELOAD,
+    MPU_CASE_COUNT
+} MpuBenchCase_t;
+
+static const char *const mpuCaseName[MPU_CASE_COUNT] = {
+    "none", "shared", "reload"
+};
+
+static Semaphore_t pingSem;
+static Semaphore_t pongSem;
+
+static MpuDomain_t domainMain;
+static MpuDomain_t domainPeer;
+
+static TCB_t tcb_main;
+static uint32_t stack_main[MPU_BENCH_STACK_WORDS] __attribute__((aligned(1024)));
+static TCB_t tcb_peer;
+static uint32_t stack_peer[MPU_BENCH_STACK_WORDS] __attribute__((aligned(1024)));
+
+static MpuDomain_t domainIso;
+static TCB_t tcb_iso;
+static uint32_t stack_iso[MPU_BENCH_STACK_WORDS] __attribute__((aligned(1024)));
+static Semaphore_t isoStartSem;
+static Queue_t isoResultQueue;
+static int32_t isoResultBuffer[2];
+static volatile uint32_t isoVictim;     // 커널 메모리: 격리 태스크 도메인 밖
+
+#define MPU_ISO_MESSAGE         "MPU isolated task: syscall from unprivileged domain\r\n"
+
+/* 비특권 + 자기 스택만 보이는 도메인. 결과는 전역 변수 대신 큐로 돌려줌 */
+static void MpuBench_IsoFunc(void *params)
+{
+    int32_t result;
+    (void)params;
+
+    Sys_SemaphoreWait(&isoStartSem, TASK_WAIT_FOREVER);
+
+    result = Sys_ConsoleWrite(MPU_ISO_MESSAGE, sizeof(MPU_ISO_MESSAGE) - 1U);
+    Sys_QueueSend(&isoResultQueue, &result, TASK_WAIT_FOREVER);
+
+    // 커널이 대신 써 줄 버퍼로 커널 변수를 넘김: 래퍼가 거부해야 함
+    result = Sys_QueueReceive(&isoResultQueue, (void *)&isoVictim, 0);
+    Sys_QueueSend(&isoResultQueue, &result, TASK_WAIT_FOREVER);
+
+    // 직접 접근: MemManage -> 이 태스크만 정지 (Mpu_HandleFault)
+    isoVictim = 1U;
+
+    while (1) {
+        Sys_Delay(1);
+    }
+}
+
+/* 격리 태스크를 한 번 실행시키고 결과 확인 */
+static void MpuBench_CheckIsolation(void)
+{
+    int32_t written = 0;
+    int32_t badPtr = 0;
+    uint32_t faults = Mpu_GetFaultCount();
+    uint8_t contained;
+
+    // 더 높은 우선순위라 여기서 바로 실행되어 폴트로 정지할 때까지 돎
+    Semaphore_Signal(&isoStartSem);
+    Queue_Receive(&isoResultQueue, &written, SYSTICK_FREQ_HZ);
+    Queue_Receive(&isoResultQueue, &badPtr, SYSTICK_FREQ_HZ);
+    Task_Delay(1);
+
+    contained = (Mpu_GetFaultCount() == faults + 1U && tcb_iso.state == TASK_STATE_SUSPENDED
+                 && isoVictim == 0U);
+    printf("MPU isolation syscall=%ld bad_ptr=%ld fault=%s\r\n",
+           (long)written, (long)badPtr, contained ? "contained" : "missed");
+
+    if (written != (int32_t)(sizeof(MPU_ISO_MESSAGE) - 1U) || badPtr != -1 || !contained) {
+        tm_check_fail("MPU isolation check failed\r\n");
+    }
+}
+
+/* 더 높은 우선순위: ping을 받으면 바로 pong으로 돌려줌 */
+static void MpuBench_PeerFunc(void *params)
+{
+    (void)params;
+
+    while (1) {
+        Semaphore_Wait(&pingSem, TASK_WAIT_FOREVER);
+        Semaphore_Signal(&pongSem);
+    }
+}
+
+/* 두 태스크가 모두 블록/대기 중일 때만 호출 (다음 스위치부터 적용) */
+static void MpuBench_SetCase(MpuBenchCase_t c)
+{
+    switch (c) {
+    case MPU_CASE_SHARED:
+        Task_SetMpuDomain(&tcb_main, &domainMain);
+        Task_SetMpuDomain(&tcb_peer, &domainMain);
+        break;
+    case MPU_CASE_RELOAD:
+        Task_SetMpuDomain(&tcb_main, &domainMain);
+        Task_SetMpuDomain(&tcb_peer, &domainPeer);
+        break;
+    case MPU_CASE_NONE:
+    default:
+        Task_SetMpuDomain(&tcb_main, NULL);
+        Task_SetMpuDomain(&tcb_peer, NULL);
+        break;
+    }
+}
+
+/* 왕복 1회당 사이클 */
+static uint32_t MpuBench_Run(void)
+{
+    uint32_t t0 = DWT->CYCCNT;
+
+    for (uint32_t i = 0; i < MPU_BENCH_ROUNDS; i++) {
+        Semaphore_Signal(&pingSem);     // peer로 스위치
+        Semaphore_Wait(&pongSem, 0);    // peer가 돌려준 토큰 (블록 안 함)
+    }
+    return (DWT->CYCCNT - t0) / MPU_BENCH_ROUNDS;
+}
+
+static void MpuBench_MainFunc(void *params)
+{
+    uint32_t roundTrip[MPU_CASE_COUNT];
+    (void)params;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    MpuBench_CheckIsolation();
+
+    while (1) {
+        for (int c = 0; c < MPU_CASE_COUNT; c++) {
+            MpuBench_SetCase((MpuBenchCase_t)c);
+            roundTrip[c] = MpuBench_Run();
+        }
+        MpuBench_SetCase(MPU_CASE_NONE);
+
+        for (int c = 0; c < MPU_CASE_COUNT; c++) {
+            int32_t delta = (int32_t)(roundTrip[c] - roundTrip[MPU_CASE_NONE]) / 2;
+            printf("MPU %s switch=%lu delta=%ld\r\n", mpuCaseName[c],
+                   (unsigned long)(roundTrip[c] / 2), (long)delta);
+        }
+
+        Task_Delay(MPU_BENCH_PERIOD_SECONDS * SYSTICK_FREQ_HZ);
+    }
+}
+
+void tm_main(void)
+{
+    Semaphore_Init(&pingSem, 0);
+    Semaphore_Init(&pongSem, 0);
+    Semaphore_Init(&isoStartSem, 0);
+    Queue_Init(&isoResultQueue, isoResultBuffer, sizeof(int32_t), 2);
+
+    // 실제 격리용과 같은 모양: 스택 + 주변장치 + 공유 버퍼 영역
+    Mpu_InitDomain(&domainMain);
+    Mpu_SetRegion(&domainMain, 0, stack_main, sizeof(stack_main), MPU_ACCESS_RW);
+    Mpu_SetRegion(&domainMain, 1, (void *)USART2_BASE, 1024, MPU_ACCESS_DEVICE);
+    Mpu_InitDomain(&domainPeer);
+    Mpu_SetRegion(&domainPeer, 0, stack_peer, sizeof(stack_peer), MPU_ACCESS_RW);
+    Mpu_SetRegion(&domainPeer, 1, (void *)GPIOA_BASE, 1024, MPU_ACCESS_DEVICE);
+
+    Task_CreateStatic(&tcb_peer, stack_peer, sizeof(stack_peer),
+                      MpuBench_PeerFunc, "MpuPeer", NULL, 0, 0);
+    Task_CreateStatic(&tcb_main, stack_main, sizeof(stack_main),
+                      MpuBench_MainFunc, "MpuMain", NULL, 1, 0);
+
+    // 스택만 RW: Flash(코드/상수)는 커널 고정 영역 0으로 읽기 가능
+    Mpu_InitDomain(&domainIso);
+    Mpu_SetRegion(&domainIso, 0, stack_iso, sizeof(stack_iso), MPU_ACCESS_RW);
+    Task_CreateStatic(&tcb_iso, stack_iso, sizeof(stack_iso),
+                      MpuBench_IsoFunc, "MpuIso", NULL, 0, 0);
+    Task_SetUnprivileged(&tcb_iso);
+    Task_SetMpuDomain(&tcb_iso, &domainIso);
+}
@@ -0,0 +1,115 @@
+/*
+ * tm_partition_test.c
+ *
+ * 시간 분할: 메이저 프레임 10ms = 파티션 1 (6ms) + 파티션 2 (3ms) + 빈 창 (1ms).
+ * 파티션마다 CPU 바운드 태스크를 두고 실제 CPU 몫과 창 전환 지연을 잰다.
+ *
+ *   PARTITION frame_us=<us> p1=<permille> p2=<permille> switches=<n> switch_max=<cyc>
+ *
+ *   p1/p2:      측정 구간 동안 두 태스크가 돈 루프 횟수 비율 (6:3 -> 약 667/333)
+ *   switch_max: 창 경계 타이머 ISR 진입부터 새 파티션 태스크가 처음 돌기까지 최대 사이클
+ *
+ * 측정 태스크는 시스템 파티션(0)이라 어느 창에서든 깨어남 (측정 오차를 줄이려고 드물게).
+ */
+
+#include <stdio.h>
+
+#include "main.h"
+#include "scheduler.h"
+#include "task.h"
+#include "partition.h"
+#include "tm_api.h"
+
+#if !PARTITION_ENABLE
+#error "build with PARTITION_ENABLE=1"
+#endif
+
+#define PARTITION_BENCH_CONTROL 1
+#define PARTITION_BENCH_COMMS   2
+#define PARTITION_BENCH_SPARE   3       // 태스크 없는 창: idle
+
+static const PartitionWindow_t partitionFrame[] = {
+    { PARTITION_BENCH_CONTROL, 6000 },
+    { PARTITION_BENCH_COMMS,   3000 },
+    { PARTITION_BENCH_SPARE,   1000 },
+};
+
+#define PARTITION_BENCH_FRAME_US    10000
+
+typedef struct {
+    volatile uint32_t count;
+    volatile uint32_t switchMax;
+} PartitionBenchStat_t;
+
+static PartitionBenchStat_t statControl;
+static PartitionBenchStat_t statComms;
+
+static TCB_t tcb_control;
+static TCB_t tcb_comms;
+static TCB_t tcb_main;
+static uint32_t stack_control[256];
+static uint32_t stack_comms[256];
+static uint32_t stack_main[512];
+
+static void PartitionBench_SpinFunc(void *params)
+{
+    PartitionBenchStat_t *stat = (PartitionBenchStat_t *)params;
+    uint32_t seen = Partition_GetSwitchCount();
+
+    while (1) {
+        uint32_t switches = Partition_GetSwitchCount();
+
+        // 창이 바뀐 뒤 처음 도는 루프: ISR 진입부터 여기까지가 전환 지연
+        if (switches != seen) {
+            uint32_t latency = DWT->CYCCNT - Partition_GetSwitchStamp();
+            if (latency > stat->switchMax) {
+                stat->switchMax = latency;
+            }
+            seen = switches;
+        }
+        stat->count++;
+    }
+}
+
+static void PartitionBench_MainFunc(void *params)
+{
+    uint32_t control, comms, total, switchStart;
+    (void)params;
+
+    while (1) {
+        statControl.count = 0;
+        statComms.count = 0;
+        statControl.switchMax = 0;
+        statComms.switchMax = 0;
+        switchStart = Partition_GetSwitchCount();
+
+        Task_Delay(TM_TEST_DURATION * SYSTICK_FREQ_HZ);
+
+        control = statControl.count;
+        comms = statComms.count;
+        total = (control + comms != 0) ? control + comms : 1;
+        printf("PARTITION frame_us=%u p1=%lu p2=%lu switches=%lu switch_max=%lu\r\n",
+               (unsigned)PARTITION_BENCH_FRAME_US,
+               (unsigned long)((uint64_t)control * 1000U / total),
+               (unsigned long)((uint64_t)comms * 1000U / total),
+               (unsigned long)(Partition_GetSwitchCount() - switchStart),
+               (unsigned long)((statControl.switchMax > statComms.switchMax)
+                               ? statControl.switchMax : statComms.switchMax));
+    }
+}
+
+void tm_main(void)
+{
+    Partition_SetSchedule(partitionFrame, sizeof(partitionFrame) / sizeof(partitionFrame[0]));
+
+    // 두 파티션 태스크는 같은 우선순위: 서로의 창에서는 실행 후보가 아님
+    Task_CreateStatic(&tcb_control, stack_control, sizeof(stack_control),
+                      PartitionBench_SpinFunc, "Control", &statControl, 2, 0);
+    Task_SetPartition(&tcb_control, PARTITION_BENCH_CONTROL);
+    Task_CreateStatic(&tcb_comms, stack_comms, sizeof(stack_comms),
+                      PartitionBench_SpinFunc, "Comms", &statComms, 2, 0);
+    Task_SetPartition(&tcb_comms, PARTITION_BENCH_COMMS);
+
+    Task_CreateStatic(&tcb_main, stack_main, sizeof(stack_main),
+                      PartitionBench_MainFunc, "PartMain", NULL, 0, 0);
+}
@@ -0,0 +1,129 @@
+/*
+ * tm_periodic_release_test.c
+ *
+ * 상대 지연(Task_Delay) 루프와 절대 릴리스(Task_WaitForNextPeriod) 루프의 누적 드리프트 비교.
+ *
+ *   PERIODIC period=<tick> jobs=<n> delay_drift=<tick> period_drift=<tick> jitter=<cyc>
+ *            misses=<n> overruns=<n> miss_hooks=<n> overrun_hooks=<n>
+ *
+ *   delay_drift:  Task_Delay(period) 루프가 n잡 뒤 이상적인 릴리스 시각보다 늦은 틱
+ *   period_drift: 같은 작업량을 Task_WaitForNextPeriod로 돌렸을 때 (0이어야 함)
+ *   jitter:       주기 루프에서 연속 릴리스 간격과 이상적인 간격의 최대 차이 (사이클)
+ *   misses/overruns: 마지막 잡 하나는 일부러 주기의 1.5배를 돌려서 둘 다 1씩 나와야 함
+ */
+
+#include <stdio.h>
+
+#include "main.h"
+#include "scheduler.h"
+#include "task.h"
+#include "tm_api.h"
+
+#ifndef PERIODIC_BENCH_PERIOD
+#define PERIODIC_BENCH_PERIOD   2       // 틱 (500 Hz)
+#endif
+
+#ifndef PERIODIC_BENCH_JOBS
+#define PERIODIC_BENCH_JOBS     500
+#endif
+
+/* 잡 하나의 작업량: 주기의 약 30% */
+#define PERIODIC_BENCH_WORK_US  (PERIODIC_BENCH_PERIOD * 1000U * 3U / 10U)
+
+static volatile uint32_t missHooks;
+static volatile uint32_t overrunHooks;
+
+static TCB_t tcb_main;
+static uint32_t stack_main[512];
+
+void Task_DeadlineMissHook(TCB_t *tcb)
+{
+    (void)tcb;
+    missHooks++;
+}
+
+void Task_OverrunHook(TCB_t *tcb)
+{
+    (void)tcb;
+    overrunHooks++;
+}
+
+static void PeriodicBench_Work(uint32_t us)
+{
+    uint32_t start = DWT->CYCCNT;
+    uint32_t cycles = us * (SystemCoreClock / 1000000U);
+
+    while (DWT->CYCCNT - start < cycles);
+}
+
+static void PeriodicBench_MainFunc(void *params)
+{
+    uint32_t start, ideal, delayDrift, periodDrift;
+    uint32_t lastRelease, jitter;
+    uint32_t periodCycles;
+    (void)params;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    while (1) {
+        periodCycles = PERIODIC_BENCH_PERIOD * (SystemCoreClock / SYSTICK_FREQ_HZ);
+
+        // 상대 지연: 잡마다 작업 시간만큼 밀림
+        Task_Delay(1);
+        start = Task_GetTickCount();
+        for (uint32_t i = 0; i < PERIODIC_BENCH_JOBS; i++) {
+            PeriodicBench_Work(PERIODIC_BENCH_WORK_US);
+            Task_Delay(PERIODIC_BENCH_PERIOD);
+        }
+        ideal = start + PERIODIC_BENCH_JOBS * PERIODIC_BENCH_PERIOD;
+        delayDrift = Task_GetTickCount() - ideal;
+
+        // 절대 릴리스
+        Task_Delay(1);
+        Task_SetPeriod(currentTask, PERIODIC_BENCH_PERIOD, 0);
+        start = Task_GetTickCount();
+        jitter = 0;
+        lastRelease = DWT->CYCCNT;
+        for (uint32_t i = 0; i < PERIODIC_BENCH_JOBS; i++) {
+            PeriodicBench_Work(PERIODIC_BENCH_WORK_US);
+            Task_WaitForNextPeriod();
+
+            uint32_t now = DWT->CYCCNT;
+            uint32_t interval = now - lastRelease;
+            uint32_t error = (interval > periodCycles) ? interval - periodCycles
+                                                        : periodCycles - interval;
+            if (i > 0 && error > jitter) {
+                jitter = error;
+            }
+            lastRelease = now;
+        }
+        ideal = start + PERIODIC_BENCH_JOBS * PERIODIC_BENCH_PERIOD;
+        periodDrift = Task_GetTickCount() - ideal;
+
+        // 일부러 1.5주기짜리 잡 하나: 데드라인 미스 + 오버런
+        PeriodicBench_Work(PERIODIC_BENCH_PERIOD * 1500U);
+        Task_WaitForNextPeriod();
+
+        printf("PERIODIC period=%u jobs=%u delay_drift=%lu period_drift=%lu jitter=%lu "
+               "misses=%lu overruns=%lu miss_hooks=%lu overrun_hooks=%lu\r\n",
+               (unsigned)PERIODIC_BENCH_PERIOD, (unsigned)PERIODIC_BENCH_JOBS,
+               (unsigned long)delayDrift, (unsigned long)periodDrift, (unsigned long)jitter,
+               (unsigned long)tcb_main.deadlineMisses, (unsigned long)tcb_main.overruns,
+               (unsigned long)missHooks, (unsigned long)overrunHooks);
+
+        Task_SetPeriod(currentTask, 0, 0);
+        tcb_main.deadlineMisses = 0;
+        tcb_main.overruns = 0;
+        missHooks = 0;
+        overrunHooks = 0;
+
+        Task_Delay(TM_TEST_DURATION * SYSTICK_FREQ_HZ);
+    }
+}
+
+void tm_main(void)
+{
+    Task_CreateStatic(&tcb_main, stack_main, sizeof(stack_main),
+                      PeriodicBench_MainFunc, "PeriodicMain", NULL, 0, 0);
+}
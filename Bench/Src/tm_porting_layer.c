@@ -0,0 +1,249 @@
+/*
+ * tm_porting_layer.c
+ *
+ * Thread-Metric API -> 커널 API 매핑 및 벤치마크용 보드 초기화.
+ * 보드 초기화(클럭, USART2)는 Core/Src/main.c 와 동일하게 유지할 것.
+ */
+
+#include <stdio.h>
+
+#include "main.h"
+#include "SEGGER_RTT.h"
+#include "clock.h"
+#include "console.h"
+#include "scheduler.h"
+#include "task.h"
+#include "semaphore.h"
+#include "queue.h"
+#include "mempool.h"
+#include "tm_api.h"
+
+#define TM_STACK_WORDS          256
+#define TM_QUEUE_DEPTH          10
+#define TM_MESSAGE_WORDS        4
+#define TM_POOL_BLOCK_SIZE      128
+#define TM_POOL_BLOCK_COUNT     16
+
+/* 커널 API를 호출하지 않는 벡터를 소프트웨어 인터럽트로 사용 */
+#define TM_INTERRUPT_IRQn       EXTI4_IRQn
+
+UART_HandleTypeDef huart2;
+DMA_HandleTypeDef hdma_usart2_rx;
+DMA_HandleTypeDef hdma_usart2_tx;
+
+static TCB_t tm_thread_tcb[TM_MAX_THREADS];
+static uint32_t tm_thread_stack[TM_MAX_THREADS][TM_STACK_WORDS] __attribute__((aligned(8)));
+static void (*tm_thread_entry[TM_MAX_THREADS])(void);
+
+static Queue_t tm_queue[TM_MAX_QUEUES];
+static unsigned long tm_queue_buffer[TM_MAX_QUEUES][TM_QUEUE_DEPTH * TM_MESSAGE_WORDS];
+
+static Semaphore_t tm_semaphore[TM_MAX_SEMAPHORES];
+
+static MemPool_t tm_pool[TM_MAX_MEMORY_POOLS];
+static uint32_t tm_pool_buffer[TM_MAX_MEMORY_POOLS][TM_POOL_BLOCK_SIZE * TM_POOL_BLOCK_COUNT / 4];
+
+static void tm_hardware_init(void);
+
+int _write(int file, char *ptr, int len)
+{
+  SEGGER_RTT_Write(0, ptr, (unsigned)len);
+  return Console_Write(ptr, (uint32_t)len);
+}
+
+int main(void)
+{
+  tm_hardware_init();
+  tm_initialize(tm_main);
+
+  while (1)
+  {
+  }
+}
+
+static void tm_thread_trampoline(void *params)
+{
+    int thread_id = (int)(uintptr_t)params;
+
+    tm_thread_entry[thread_id]();
+
+    // Thread-Metric 스레드는 리턴하지 않지만, 리턴 시 영구 정지
+    Task_Suspend(currentTask);
+}
+
+int tm_initialize(void (*test_initialization_function)(void))
+{
+    NVIC_SetPriority(TM_INTERRUPT_IRQn, 0x0F);
+    NVIC_EnableIRQ(TM_INTERRUPT_IRQn);
+
+    test_initialization_function();
+
+    Task_StartScheduler();
+    return TM_ERROR;
+}
+
+/* Thread-Metric 규약대로 생성 직후에는 SUSPENDED, tm_thread_resume로 시작 */
+int tm_thread_create(int thread_id, int priority, void (*entry_function)(void))
+{
+    if (thread_id < 0 || thread_id >= TM_MAX_THREADS
+        || priority < 0 || priority >= MAX_PRIORITY_LEVELS - 1) {
+        return TM_ERROR;
+    }
+
+    tm_thread_entry[thread_id] = entry_function;
+    Task_CreateStatic(&tm_thread_tcb[thread_id], tm_thread_stack[thread_id],
+                      sizeof(tm_thread_stack[thread_id]), tm_thread_trampoline,
+                      "TM", (void *)(uintptr_t)thread_id, (uint8_t)priority, 0);
+    Task_Suspend(&tm_thread_tcb[thread_id]);
+
+    return TM_SUCCESS;
+}
+
+int tm_thread_resume(int thread_id)
+{
+    Task_Resume(&tm_thread_tcb[thread_id]);
+    return TM_SUCCESS;
+}
+
+int tm_thread_suspend(int thread_id)
+{
+    Task_Suspend(&tm_thread_tcb[thread_id]);
+    return TM_SUCCESS;
+}
+
+void tm_thread_relinquish(void)
+{
+    Task_Yield();
+}
+
+void tm_thread_sleep(int seconds)
+{
+    Task_Delay((uint32_t)seconds * SYSTICK_FREQ_HZ);
+}
+
+int tm_queue_create(int queue_id)
+{
+    Queue_Init(&tm_queue[queue_id], tm_queue_buffer[queue_id],
+               TM_MESSAGE_WORDS * sizeof(unsigned long), TM_QUEUE_DEPTH);
+    return TM_SUCCESS;
+}
+
+int tm_queue_send(int queue_id, unsigned long *message_ptr)
+{
+    return (Queue_Send(&tm_queue[queue_id], message_ptr, 0) == 0) ? TM_SUCCESS : TM_ERROR;
+}
+
+int tm_queue_receive(int queue_id, unsigned long *message_ptr)
+{
+    return (Queue_Receive(&tm_queue[queue_id], message_ptr, 0) == 0) ? TM_SUCCESS : TM_ERROR;
+}
+
+int tm_semaphore_create(int semaphore_id)
+{
+    Semaphore_Init(&tm_semaphore[semaphore_id], 1);
+    return TM_SUCCESS;
+}
+
+int tm_semaphore_get(int semaphore_id)
+{
+    return (Semaphore_Wait(&tm_semaphore[semaphore_id], 0) == 0) ? TM_SUCCESS : TM_ERROR;
+}
+
+int tm_semaphore_put(int semaphore_id)
+{
+    Semaphore_Signal(&tm_semaphore[semaphore_id]);
+    return TM_SUCCESS;
+}
+
+int tm_memory_pool_create(int pool_id)
+{
+    MemPool_Init(&tm_pool[pool_id], tm_pool_buffer[pool_id],
+                 TM_POOL_BLOCK_SIZE, TM_POOL_BLOCK_COUNT);
+    return TM_SUCCESS;
+}
+
+int tm_memory_pool_allocate(int pool_id, unsigned char **memory_ptr)
+{
+    *memory_ptr = (unsigned char *)MemPool_Alloc(&tm_pool[pool_id]);
+    return (*memory_ptr != NULL) ? TM_SUCCESS : TM_ERROR;
+}
+
+int tm_memory_pool_deallocate(int pool_id, unsigned char *memory_ptr)
+{
+    MemPool_Free(&tm_pool[pool_id], memory_ptr);
+    return TM_SUCCESS;
+}
+
+void tm_cause_interrupt(void)
+{
+    NVIC_SetPendingIRQ(TM_INTERRUPT_IRQn);
+    __DSB();
+    __ISB();
+}
+
+__attribute__((weak)) void tm_interrupt_handler(void)
+{
+}
+
+void EXTI4_IRQHandler(void)
+{
+    tm_interrupt_handler();
+}
+
+void tm_report(const char *test_name, unsigned long relative_time,
+               unsigned long period_total)
+{
+    printf("**** Thread-Metric %s Test **** Relative Time: %lu\r\n",
+           test_name, relative_time);
+    printf("Time Period Total:  %lu\r\n\r\n", period_total);
+}
+
+void tm_check_fail(const char *message)
+{
+    printf("%s", message);
+    Console_Flush();
+    __disable_irq();
+    while (1);
+}
+
+/*---------------------------------------------------------------------------
+ * 보드 초기화 - main.c 의 SystemClock_Config / MX_DMA_Init / MX_USART2_UART_Init 과 동일
+ * (기본 클럭 프로파일 = CLOCK_PROFILE_DEFAULT)
+ *---------------------------------------------------------------------------*/
+static void tm_hardware_init(void)
+{
+  HAL_Init();
+
+  if (Clock_SetProfile(CLOCK_PROFILE_DEFAULT) != HAL_OK)
+  {
+    Error_Handler();
+  }
+
+  __HAL_RCC_GPIOA_CLK_ENABLE();
+  __HAL_RCC_DMA1_CLK_ENABLE();
+  HAL_NVIC_SetPriority(DMA1_Stream6_IRQn, 5, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Stream6_IRQn);
+
+  huart2.Instance = USART2;
+  huart2.Init.BaudRate = 115200;
+  huart2.Init.WordLength = UART_WORDLENGTH_8B;
+  huart2.Init.StopBits = UART_STOPBITS_1;
+  huart2.Init.Parity = UART_PARITY_NONE;
+  huart2.Init.Mode = UART_MODE_TX_RX;
+  huart2.Init.HwFlowCtl = UART_HWCONTROL_NONE;
+  huart2.Init.OverSampling = UART_OVERSAMPLING_16;
+  if (HAL_UART_Init(&huart2) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  Clock_RegisterUart(&huart2);
+  Console_Init(&huart2);
+}
+
+void Error_Handler(void)
+{
+  __disable_irq();
+  while (1)
+  {
+  }
+}
@@ -0,0 +1,146 @@
+/*
+ * tm_preempt_threshold_test.c
+ *
+ * 생산자(우선순위 2) -> 소비자(우선순위 1) 큐 전달에서 선점 임계값의 효과.
+ *
+ *   PTHRESH items=<n> batch=<n> switches_off=<n> switches_on=<n> cyc_off=<cyc> cyc_on=<cyc>
+ *
+ *   off: 생산자 임계값 = 우선순위. 보낼 때마다 소비자가 선점 (아이템당 전환 2번)
+ *   on:  생산자 임계값 = 소비자 우선순위. 생산자가 배치를 다 넣고 블록할 때만 전환
+ *   switches: 생산자/소비자 사이 실행 주체가 바뀐 횟수
+ *   cyc:      아이템 하나당 평균 사이클
+ */
+
+#include <stdio.h>
+
+#include "main.h"
+#include "scheduler.h"
+#include "task.h"
+#include "queue.h"
+#include "semaphore.h"
+#include "tm_api.h"
+
+#ifndef PTHRESH_BENCH_ITEMS
+#define PTHRESH_BENCH_ITEMS     8000
+#endif
+
+#define PTHRESH_BENCH_BATCH     8
+
+#define PTHRESH_CONSUMER_PRIORITY   1
+#define PTHRESH_PRODUCER_PRIORITY   2
+#define PTHRESH_MAIN_PRIORITY       3
+
+enum { RUNNER_NONE, RUNNER_PRODUCER, RUNNER_CONSUMER };
+
+static Queue_t queue;
+static uint32_t queueBuffer[PTHRESH_BENCH_BATCH];
+static Semaphore_t startSem;
+static Semaphore_t batchDone;
+static Semaphore_t doneSem;
+
+static volatile uint32_t switches;
+static volatile uint8_t lastRunner;
+static volatile uint32_t checksum;
+
+static TCB_t tcb_producer;
+static TCB_t tcb_consumer;
+static TCB_t tcb_main;
+static uint32_t stack_producer[256];
+static uint32_t stack_consumer[256];
+static uint32_t stack_main[512];
+
+static inline void PtBench_Note(uint8_t runner)
+{
+    if (lastRunner != runner) {
+        switches++;
+        lastRunner = runner;
+    }
+}
+
+static void PtBench_ConsumerFunc(void *params)
+{
+    uint32_t item;
+    uint32_t received = 0;
+    (void)params;
+
+    while (1) {
+        Queue_Receive(&queue, &item, TASK_WAIT_FOREVER);
+        PtBench_Note(RUNNER_CONSUMER);
+        checksum += item;
+        if (++received % PTHRESH_BENCH_BATCH == 0) {
+            Semaphore_Signal(&batchDone);
+        }
+    }
+}
+
+static void PtBench_ProducerFunc(void *params)
+{
+    (void)params;
+
+    while (1) {
+        Semaphore_Wait(&startSem, TASK_WAIT_FOREVER);
+
+        for (uint32_t i = 0; i < PTHRESH_BENCH_ITEMS; i += PTHRESH_BENCH_BATCH) {
+            for (uint32_t j = 0; j < PTHRESH_BENCH_BATCH; j++) {
+                uint32_t item = i + j;
+                PtBench_Note(RUNNER_PRODUCER);
+                Queue_Send(&queue, &item, TASK_WAIT_FOREVER);
+            }
+            Semaphore_Wait(&batchDone, TASK_WAIT_FOREVER);
+        }
+        Semaphore_Signal(&doneSem);
+    }
+}
+
+/* 반환: 아이템당 평균 사이클 */
+static uint32_t PtBench_Round(uint8_t threshold, uint32_t *switchCount)
+{
+    uint32_t start;
+
+    Task_SetPreemptThreshold(&tcb_producer, threshold);
+    switches = 0;
+    lastRunner = RUNNER_NONE;
+
+    start = DWT->CYCCNT;
+    Semaphore_Signal(&startSem);
+    Semaphore_Wait(&doneSem, TASK_WAIT_FOREVER);
+
+    *switchCount = switches;
+    return (DWT->CYCCNT - start) / PTHRESH_BENCH_ITEMS;
+}
+
+static void PtBench_MainFunc(void *params)
+{
+    uint32_t switchesOff, switchesOn, cyclesOff, cyclesOn;
+    (void)params;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    while (1) {
+        cyclesOff = PtBench_Round(PTHRESH_PRODUCER_PRIORITY, &switchesOff);
+        cyclesOn = PtBench_Round(PTHRESH_CONSUMER_PRIORITY, &switchesOn);
+
+        printf("PTHRESH items=%u batch=%u switches_off=%lu switches_on=%lu cyc_off=%lu cyc_on=%lu\r\n",
+               (unsigned)PTHRESH_BENCH_ITEMS, (unsigned)PTHRESH_BENCH_BATCH,
+               (unsigned long)switchesOff, (unsigned long)switchesOn,
+               (unsigned long)cyclesOff, (unsigned long)cyclesOn);
+
+        Task_Delay(TM_TEST_DURATION * SYSTICK_FREQ_HZ);
+    }
+}
+
+void tm_main(void)
+{
+    Queue_Init(&queue, queueBuffer, sizeof(uint32_t), PTHRESH_BENCH_BATCH);
+    Semaphore_Init(&startSem, 0);
+    Semaphore_Init(&batchDone, 0);
+    Semaphore_Init(&doneSem, 0);
+
+    Task_CreateStatic(&tcb_consumer, stack_consumer, sizeof(stack_consumer),
+                      PtBench_ConsumerFunc, "PtConsumer", NULL, PTHRESH_CONSUMER_PRIORITY, 0);
+    Task_CreateStatic(&tcb_producer, stack_producer, sizeof(stack_producer),
+                      PtBench_ProducerFunc, "PtProducer", NULL, PTHRESH_PRODUCER_PRIORITY, 0);
+    Task_CreateStatic(&tcb_main, stack_main, sizeof(stack_main),
+                      PtBench_MainFunc, "PtMain", NULL, PTHRESH_MAIN_PRIORITY, 0);
+}
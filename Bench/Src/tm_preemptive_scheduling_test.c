@@ -0,0 +1,102 @@
+/*
+ * tm_preemptive_scheduling_test.c
+ *
+ * 우선순위가 서로 다른 스레드 5개. 각 스레드는 카운터를 올리고 바로 위
+ * 우선순위 스레드를 resume(즉시 선점)한 뒤 자신을 suspend 한다.
+ * 구간당 선점 횟수를 측정.
+ */
+
+#include "tm_api.h"
+
+#define TM_PREEMPT_THREADS      5
+
+static volatile unsigned long tm_preemptive_thread_counter[TM_PREEMPT_THREADS];
+
+/* 가장 낮은 우선순위 - suspend 하지 않고 계속 체인을 시작 */
+static void tm_preemptive_thread_0_entry(void)
+{
+    while (1) {
+        tm_preemptive_thread_counter[0]++;
+        tm_thread_resume(1);
+    }
+}
+
+static void tm_preemptive_thread_1_entry(void)
+{
+    while (1) {
+        tm_preemptive_thread_counter[1]++;
+        tm_thread_resume(2);
+        tm_thread_suspend(1);
+    }
+}
+
+static void tm_preemptive_thread_2_entry(void)
+{
+    while (1) {
+        tm_preemptive_thread_counter[2]++;
+        tm_thread_resume(3);
+        tm_thread_suspend(2);
+    }
+}
+
+static void tm_preemptive_thread_3_entry(void)
+{
+    while (1) {
+        tm_preemptive_thread_counter[3]++;
+        tm_thread_resume(4);
+        tm_thread_suspend(3);
+    }
+}
+
+/* 가장 높은 우선순위 - 자신만 suspend */
+static void tm_preemptive_thread_4_entry(void)
+{
+    while (1) {
+        tm_preemptive_thread_counter[4]++;
+        tm_thread_suspend(4);
+    }
+}
+
+static void tm_preemptive_thread_report(void)
+{
+    unsigned long last_total = 0;
+    unsigned long relative_time = 0;
+    unsigned long cycles = 0;
+
+    while (TM_TEST_CYCLES == 0 || cycles++ < TM_TEST_CYCLES) {
+        unsigned long total = 0;
+        unsigned long average;
+
+        tm_thread_sleep(TM_TEST_DURATION);
+        relative_time += TM_TEST_DURATION;
+
+        for (int i = 0; i < TM_PREEMPT_THREADS; i++) {
+            total += tm_preemptive_thread_counter[i];
+        }
+
+        average = total / TM_PREEMPT_THREADS;
+        for (int i = 0; i < TM_PREEMPT_THREADS; i++) {
+            if (tm_preemptive_thread_counter[i] + 1 < average
+                || tm_preemptive_thread_counter[i] > average + 1) {
+                tm_check_fail("ERROR: Invalid counter value(s). Preemptive counters should not be more that 1 different than the average!\r\n");
+            }
+        }
+
+        tm_report("Preemptive Scheduling", relative_time, total - last_total);
+        last_total = total;
+    }
+}
+
+void tm_main(void)
+{
+    tm_thread_create(0, 6, tm_preemptive_thread_0_entry);
+    tm_thread_create(1, 5, tm_preemptive_thread_1_entry);
+    tm_thread_create(2, 4, tm_preemptive_thread_2_entry);
+    tm_thread_create(3, 3, tm_preemptive_thread_3_entry);
+    tm_thread_create(4, 2, tm_preemptive_thread_4_entry);
+
+    tm_thread_resume(0);
+
+    tm_thread_create(5, 0, tm_preemptive_thread_report);
+    tm_thread_resume(5);
+}
@@ -0,0 +1,174 @@
+/*
+ * tm_slice_accounting_test.c
+ *
+ * 같은 우선순위 두 태스크(타임 슬라이스 1틱). B는 계속 돌고, A는 자기 CPU를 의사 난수만큼
+ * (슬라이스의 50~100%) 쓴 뒤 Task_Delay(1)로 블록한다. 블록 시점이 틱 위상과 무관하므로
+ * 틱에 맞물려 한쪽이 굶는 일이 없다. 같은 파일을 두 번 빌드:
+ *   RTOS_TM_slice_accounting         틱 청구: 틱 때 실행 중인 태스크가 슬라이스 전체를 냄
+ *   RTOS_TM_slice_accounting_cycles  SCHEDULER_SLICE_CYCLES=1: 실제 실행 사이클만 청구
+ *
+ *   SLICE mode=<tick|cycles> a=<permille> b=<permille> a_turn_us=<us> b_turn_us=<us> expect_a=<permille>
+ *
+ *   a/b:      측정 구간 동안 두 태스크가 돈 루프 횟수 비율
+ *   turn_us:  한 번 실행 주체가 된 뒤 다른 태스크로 넘어가기까지 평균 실행 시간 (ISR 제외)
+ *   expect_a: B가 매 차례 설정한 슬라이스만큼 돈다고 할 때의 A 몫 = a_turn / (a_turn + 슬라이스)
+ *
+ * 기대값:
+ *   tick    a 약 750, b_turn_us 약 250. A는 틱 직후 차례를 받아 틱 전에 블록하므로 청구되지 않고,
+ *           B는 남은 틱 조각만 돌고 슬라이스 전체를 냄
+ *   cycles  b_turn_us 약 1000 (슬라이스), a 약 300 = expect_a. 어긋나면 tm_check_fail
+ */
+
+#include <stdio.h>
+
+#include "main.h"
+#include "scheduler.h"
+#include "task.h"
+#include "tm_api.h"
+
+#if SCHEDULER_SLICE_CYCLES
+#define SLICE_BENCH_MODE        "cycles"
+#else
+#define SLICE_BENCH_MODE        "tick"
+#endif
+
+#define SLICE_BENCH_SLICE_TICKS     1
+#define SLICE_BENCH_TOLERANCE       100     // 퍼밀: 턴 길이 ±10%
+#define SLICE_BENCH_SPLIT_TOLERANCE 30      // 퍼밀: a와 expect_a 차이
+
+typedef struct {
+    volatile uint32_t count;
+    volatile uint32_t turns;
+    volatile uint32_t runCycles;
+    uint32_t lastCycles;
+    uint8_t jitterSleep;        // 1: 의사 난수만큼 일하고 블록
+    uint32_t jobCycles;         // 이번 블록까지 쓴 사이클 (선점돼도 이어서 셈)
+    uint32_t jobTarget;
+} SliceBenchStat_t;
+
+static SliceBenchStat_t statA = { .jitterSleep = 1 };
+static SliceBenchStat_t statB = { .jitterSleep = 0 };
+static SliceBenchStat_t *volatile lastRunner;
+static uint32_t sliceBenchSeed = 12345U;
+
+static TCB_t tcb_a;
+static TCB_t tcb_b;
+static TCB_t tcb_main;
+static uint32_t stack_a[256];
+static uint32_t stack_b[256];
+static uint32_t stack_main[512];
+
+static uint32_t SliceBench_SliceCycles(void)
+{
+    return SystemCoreClock / SYSTICK_FREQ_HZ * SLICE_BENCH_SLICE_TICKS;
+}
+
+/* 슬라이스의 50~100% 사이 의사 난수 (LCG) */
+static uint32_t SliceBench_NextJob(void)
+{
+    uint32_t slice = SliceBench_SliceCycles();
+
+    sliceBenchSeed = sliceBenchSeed * 1664525U + 1013904223U;
+    return slice / 2U + (sliceBenchSeed >> 8) % (slice / 2U);
+}
+
+/* 두 태스크가 같은 루프를 돌아야 횟수 비율이 CPU 비율이 됨 */
+static void SliceBench_SpinFunc(void *params)
+{
+    SliceBenchStat_t *stat = (SliceBenchStat_t *)params;
+
+    stat->jobTarget = SliceBench_NextJob();
+
+    while (1) {
+        uint32_t now = DWT->CYCCNT;
+
+        // 다른 태스크가 돌고 왔으면 새 차례 (ISR은 lastRunner를 바꾸지 않음)
+        if (lastRunner != stat) {
+            lastRunner = stat;
+            stat->turns++;
+        } else {
+            stat->runCycles += now - stat->lastCycles;
+            stat->jobCycles += now - stat->lastCycles;
+        }
+        stat->lastCycles = now;
+        stat->count++;
+
+        // 틱 위상이 아니라 자기 CPU 사용량 기준으로 블록: 블록 시점이 틱과 맞물리지 않음
+        if (stat->jitterSleep && stat->jobCycles >= stat->jobTarget) {
+            stat->jobCycles = 0;
+            stat->jobTarget = SliceBench_NextJob();
+            Task_Delay(1);
+        }
+    }
+}
+
+static uint32_t SliceBench_TurnUs(const SliceBenchStat_t *stat)
+{
+    uint32_t turns = (stat->turns != 0) ? stat->turns : 1;
+
+    return stat->runCycles / turns / (SystemCoreClock / 1000000U);
+}
+
+static void SliceBench_Reset(SliceBenchStat_t *stat)
+{
+    stat->count = 0;
+    stat->turns = 0;
+    stat->runCycles = 0;
+}
+
+#if SCHEDULER_SLICE_CYCLES
+static uint32_t SliceBench_AbsDiff(uint32_t x, uint32_t y)
+{
+    return (x > y) ? x - y : y - x;
+}
+#endif
+
+static void SliceBench_MainFunc(void *params)
+{
+    uint32_t a, b, total;
+    uint32_t aPermille, aTurnUs, bTurnUs, sliceUs, expectA;
+    (void)params;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    while (1) {
+        SliceBench_Reset(&statA);
+        SliceBench_Reset(&statB);
+        lastRunner = NULL;
+        Task_Delay(TM_TEST_DURATION * SYSTICK_FREQ_HZ);
+
+        a = statA.count;
+        b = statB.count;
+        total = (a + b != 0) ? a + b : 1;
+        aPermille = (uint32_t)((uint64_t)a * 1000U / total);
+        aTurnUs = SliceBench_TurnUs(&statA);
+        bTurnUs = SliceBench_TurnUs(&statB);
+        sliceUs = 1000000U / SYSTICK_FREQ_HZ * SLICE_BENCH_SLICE_TICKS;
+        expectA = aTurnUs * 1000U / (aTurnUs + sliceUs);
+
+        printf("SLICE mode=%s a=%lu b=%lu a_turn_us=%lu b_turn_us=%lu expect_a=%lu\r\n",
+               SLICE_BENCH_MODE, (unsigned long)aPermille,
+               (unsigned long)((uint64_t)b * 1000U / total),
+               (unsigned long)aTurnUs, (unsigned long)bTurnUs, (unsigned long)expectA);
+
+#if SCHEDULER_SLICE_CYCLES
+        // B는 매 차례 정확히 슬라이스만큼, A는 슬라이스를 넘지 않고, 몫은 그 비율대로
+        if (SliceBench_AbsDiff(bTurnUs, sliceUs) * 1000U > sliceUs * SLICE_BENCH_TOLERANCE
+            || aTurnUs > sliceUs + sliceUs * SLICE_BENCH_TOLERANCE / 1000U
+            || SliceBench_AbsDiff(aPermille, expectA) > SLICE_BENCH_SPLIT_TOLERANCE) {
+            tm_check_fail("SLICE split does not follow the configured slices\r\n");
+        }
+#endif
+    }
+}
+
+void tm_main(void)
+{
+    Task_CreateStatic(&tcb_a, stack_a, sizeof(stack_a),
+                      SliceBench_SpinFunc, "SliceA", &statA, 1, SLICE_BENCH_SLICE_TICKS);
+    Task_CreateStatic(&tcb_b, stack_b, sizeof(stack_b),
+                      SliceBench_SpinFunc, "SliceB", &statB, 1, SLICE_BENCH_SLICE_TICKS);
+    Task_CreateStatic(&tcb_main, stack_main, sizeof(stack_main),
+                      SliceBench_MainFunc, "SliceMain", NULL, 0, 0);
+}
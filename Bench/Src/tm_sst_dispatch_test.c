@@ -0,0 +1,113 @@
+/*
+ * tm_sst_dispatch_test.c
+ *
+ * 스택 공유 run-to-completion 태스크(sst.h)와 일반 TCB 태스크의 활성화 지연과 RAM 비용 비교.
+ *
+ *   SST handlers=<n> post_to_handler=<cyc> sem_to_task=<cyc> ram_sst=<B> ram_task=<B>
+ *
+ *   post_to_handler: Sst_Post 직전 -> 핸들러 첫 명령 (NVIC pend + 인터럽트 진입)
+ *   sem_to_task:     Semaphore_Signal 직전 -> 깨어난 태스크 첫 명령 (PendSV 컨텍스트 스위치)
+ *   ram_sst/task:    핸들러/태스크 하나당 바이트 (SST는 이벤트 버퍼 포함, 스택 없음)
+ *
+ * SST 핸들러 SST_BENCH_HANDLERS개를 같은 레벨에 두고 돌아가며 이벤트를 보낸다.
+ */
+
+#include <stdio.h>
+
+#include "main.h"
+#include "scheduler.h"
+#include "task.h"
+#include "semaphore.h"
+#include "sst.h"
+#include "tm_api.h"
+
+#ifndef SST_BENCH_HANDLERS
+#define SST_BENCH_HANDLERS      256
+#endif
+
+#ifndef SST_BENCH_ROUNDS
+#define SST_BENCH_ROUNDS        1000
+#endif
+
+#define SST_BENCH_EVENTS        2
+
+static SstTask_t sstHandlers[SST_BENCH_HANDLERS];
+static uint32_t sstEvents[SST_BENCH_HANDLERS][SST_BENCH_EVENTS];
+
+static volatile uint32_t sstLatencySum;
+static volatile uint32_t taskLatencySum;
+static volatile uint32_t taskPostCycle;
+
+static Semaphore_t wakeSem;
+static Semaphore_t doneSem;
+
+static TCB_t tcb_main;
+static uint32_t stack_main[512];
+static TCB_t tcb_wake;
+static uint32_t stack_wake[128];
+
+static void SstBench_Handler(void *context, uint32_t event)
+{
+    (void)context;
+    sstLatencySum += DWT->CYCCNT - event;
+}
+
+/* 비교 대상: 세마포어로 깨어나는 높은 우선순위 태스크 */
+static void SstBench_WakeFunc(void *params)
+{
+    (void)params;
+
+    while (1) {
+        Semaphore_Wait(&wakeSem, TASK_WAIT_FOREVER);
+        taskLatencySum += DWT->CYCCNT - taskPostCycle;
+        Semaphore_Signal(&doneSem);
+    }
+}
+
+static void SstBench_MainFunc(void *params)
+{
+    uint32_t sstAvg, taskAvg;
+    (void)params;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    while (1) {
+        sstLatencySum = 0;
+        for (uint32_t i = 0; i < SST_BENCH_ROUNDS; i++) {
+            Sst_Post(&sstHandlers[i % SST_BENCH_HANDLERS], DWT->CYCCNT);
+        }
+        sstAvg = sstLatencySum / SST_BENCH_ROUNDS;
+
+        taskLatencySum = 0;
+        for (uint32_t i = 0; i < SST_BENCH_ROUNDS; i++) {
+            taskPostCycle = DWT->CYCCNT;
+            Semaphore_Signal(&wakeSem);
+            Semaphore_Wait(&doneSem, TASK_WAIT_FOREVER);
+        }
+        taskAvg = taskLatencySum / SST_BENCH_ROUNDS;
+
+        printf("SST handlers=%u post_to_handler=%lu sem_to_task=%lu ram_sst=%u ram_task=%u\r\n",
+               (unsigned)SST_BENCH_HANDLERS, (unsigned long)sstAvg, (unsigned long)taskAvg,
+               (unsigned)(sizeof(SstTask_t) + sizeof(sstEvents[0])),
+               (unsigned)(sizeof(TCB_t) + sizeof(stack_wake)));
+
+        Task_Delay(TM_TEST_DURATION * SYSTICK_FREQ_HZ);
+    }
+}
+
+void tm_main(void)
+{
+    Semaphore_Init(&wakeSem, 0);
+    Semaphore_Init(&doneSem, 0);
+
+    for (uint32_t i = 0; i < SST_BENCH_HANDLERS; i++) {
+        Sst_TaskInit(&sstHandlers[i], SstBench_Handler, NULL, 0, sstEvents[i],
+                     SST_BENCH_EVENTS);
+    }
+
+    Task_CreateStatic(&tcb_wake, stack_wake, sizeof(stack_wake),
+                      SstBench_WakeFunc, "SstWake", NULL, 0, 0);
+    Task_CreateStatic(&tcb_main, stack_main, sizeof(stack_main),
+                      SstBench_MainFunc, "SstMain", NULL, 1, 0);
+}
@@ -0,0 +1,57 @@
+/*
+ * tm_synchronization_processing_test.c
+ *
+ * 한 스레드가 경쟁 없이 세마포어를 get/put 한다.
+ * 구간당 get/put 쌍의 횟수를 측정.
+ */
+
+#include "tm_api.h"
+
+static volatile unsigned long tm_synchronization_processing_counter;
+
+static void tm_synchronization_processing_thread_0_entry(void)
+{
+    while (1) {
+        if (tm_semaphore_get(0) != TM_SUCCESS) {
+            break;
+        }
+        if (tm_semaphore_put(0) != TM_SUCCESS) {
+            break;
+        }
+
+        tm_synchronization_processing_counter++;
+    }
+}
+
+static void tm_synchronization_processing_thread_report(void)
+{
+    unsigned long last_counter = 0;
+    unsigned long relative_time = 0;
+    unsigned long cycles = 0;
+
+    while (TM_TEST_CYCLES == 0 || cycles++ < TM_TEST_CYCLES) {
+        unsigned long counter;
+
+        tm_thread_sleep(TM_TEST_DURATION);
+        relative_time += TM_TEST_DURATION;
+
+        counter = tm_synchronization_processing_counter;
+        if (counter == last_counter) {
+            tm_check_fail("ERROR: Invalid counter value(s). Error getting/putting semaphore!\r\n");
+        }
+
+        tm_report("Synchronization Processing", relative_time, counter - last_counter);
+        last_counter = counter;
+    }
+}
+
+void tm_main(void)
+{
+    tm_semaphore_create(0);
+
+    tm_thread_create(0, 6, tm_synchronization_processing_thread_0_entry);
+    tm_thread_resume(0);
+
+    tm_thread_create(1, 0, tm_synchronization_processing_thread_report);
+    tm_thread_resume(1);
+}
@@ -0,0 +1,156 @@
+/*
+ * tm_syscall_overhead_test.c
+ *
+ * 커널 API를 직접 호출할 때와 SVC(svc.h의 Sys_*)로 호출할 때의 호출당 비용을
+ * DWT 사이클로 비교한다. 어느 태스크를 비특권으로 격리할지 판단하기 위한 수치.
+ *
+ *   SVC <call> direct=<cyc> svc_priv=<cyc> svc_unpriv=<cyc>
+ *
+ *   direct:     특권 태스크에서 커널 함수 직접 호출
+ *   svc_priv:   특권 태스크에서 Sys_* (SVC 진입/복귀 + 디스패치)
+ *   svc_unpriv: 비특권 태스크에서 Sys_* (+ CONTROL 전환, 트램펄린)
+ *
+ * 모두 블록하지 않는 경로만 측정하며, 같은 모드의 빈 루프 비용을 빼고 호출 횟수로 나눈다.
+ * 비특권 태스크는 DWT를 읽을 수 없으므로 Sys_GetCycles()로 구간 전체를 감싼다.
+ */
+
+#include <stdio.h>
+
+#include "main.h"
+#include "scheduler.h"
+#include "task.h"
+#include "semaphore.h"
+#include "svc.h"
+#include "tm_api.h"
+
+#ifndef SVC_BENCH_LOOPS
+#define SVC_BENCH_LOOPS         1000
+#endif
+
+#ifndef SVC_BENCH_PERIOD_SECONDS
+#define SVC_BENCH_PERIOD_SECONDS    5
+#endif
+
+typedef enum {
+    SVC_BENCH_EMPTY = 0,    // 루프 자체 비용 (빼기용)
+    SVC_BENCH_TICK,         // 가장 짧은 호출: 틱 카운트 읽기
+    SVC_BENCH_SEM,          // Signal + Wait(timeout 0) 한 쌍
+    SVC_BENCH_YIELD,        // 전환 없는 Yield (스케줄러 한 바퀴)
+    SVC_BENCH_COUNT
+} SvcBenchCall_t;
+
+typedef enum {
+    SVC_MODE_DIRECT = 0,
+    SVC_MODE_SVC_PRIV,
+    SVC_MODE_SVC_UNPRIV,
+    SVC_MODE_COUNT
+} SvcBenchMode_t;
+
+static const char *const svcBenchName[SVC_BENCH_COUNT] = {
+    "empty", "tick", "sem", "yield"
+};
+
+static volatile uint32_t svcBenchCycles[SVC_BENCH_COUNT][SVC_MODE_COUNT];
+static volatile uint32_t svcBenchSink;
+
+static Semaphore_t svcBenchSem;
+static Semaphore_t svcStartSem;
+static Semaphore_t svcDoneSem;
+
+static TCB_t tcb_report;
+static uint32_t stack_report[512];
+static TCB_t tcb_unpriv;
+static uint32_t stack_unpriv[256];
+
+/* 같은 루프 모양으로 body만 바꿔 N회 실행한 총 사이클 */
+#define SVC_MEASURE(result, readCycles, body)                       \
+    do {                                                            \
+        uint32_t t0_ = (readCycles);                                \
+        for (uint32_t i_ = 0; i_ < SVC_BENCH_LOOPS; i_++) {         \
+            __asm volatile ("" ::: "memory");                       \
+            body;                                                   \
+        }                                                           \
+        (result) = (readCycles) - t0_;                              \
+    } while (0)
+
+static void SvcBench_RunDirect(void)
+{
+    SVC_MEASURE(svcBenchCycles[SVC_BENCH_EMPTY][SVC_MODE_DIRECT], DWT->CYCCNT, (void)0);
+    SVC_MEASURE(svcBenchCycles[SVC_BENCH_TICK][SVC_MODE_DIRECT], DWT->CYCCNT,
+                svcBenchSink = Task_GetTickCount());
+    SVC_MEASURE(svcBenchCycles[SVC_BENCH_SEM][SVC_MODE_DIRECT], DWT->CYCCNT,
+                Semaphore_Signal(&svcBenchSem); Semaphore_Wait(&svcBenchSem, 0));
+    SVC_MEASURE(svcBenchCycles[SVC_BENCH_YIELD][SVC_MODE_DIRECT], DWT->CYCCNT,
+                Task_Yield());
+}
+
+static void SvcBench_RunSvc(SvcBenchMode_t mode)
+{
+    SVC_MEASURE(svcBenchCycles[SVC_BENCH_EMPTY][mode], Sys_GetCycles(), (void)0);
+    SVC_MEASURE(svcBenchCycles[SVC_BENCH_TICK][mode], Sys_GetCycles(),
+                svcBenchSink = Sys_GetTickCount());
+    SVC_MEASURE(svcBenchCycles[SVC_BENCH_SEM][mode], Sys_GetCycles(),
+                Sys_SemaphoreSignal(&svcBenchSem); Sys_SemaphoreWait(&svcBenchSem, 0));
+    SVC_MEASURE(svcBenchCycles[SVC_BENCH_YIELD][mode], Sys_GetCycles(),
+                Sys_Yield());
+}
+
+/* 비특권 태스크: 신호를 받을 때마다 한 번 측정 */
+static void SvcBench_UnprivFunc(void *params)
+{
+    (void)params;
+
+    while (1) {
+        Sys_SemaphoreWait(&svcStartSem, TASK_WAIT_FOREVER);
+        SvcBench_RunSvc(SVC_MODE_SVC_UNPRIV);
+        Sys_SemaphoreSignal(&svcDoneSem);
+    }
+}
+
+static uint32_t SvcBench_PerCall(SvcBenchCall_t call, SvcBenchMode_t mode)
+{
+    uint32_t total = svcBenchCycles[call][mode];
+    uint32_t empty = svcBenchCycles[SVC_BENCH_EMPTY][mode];
+
+    return (total > empty) ? (total - empty) / SVC_BENCH_LOOPS : 0;
+}
+
+static void SvcBench_ReportFunc(void *params)
+{
+    (void)params;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    while (1) {
+        SvcBench_RunDirect();
+        SvcBench_RunSvc(SVC_MODE_SVC_PRIV);
+
+        // 비특권 태스크는 더 낮은 우선순위: 여기서 블록해야 실행됨
+        Semaphore_Signal(&svcStartSem);
+        Semaphore_Wait(&svcDoneSem, TASK_WAIT_FOREVER);
+
+        for (int call = SVC_BENCH_TICK; call < SVC_BENCH_COUNT; call++) {
+            printf("SVC %s direct=%lu svc_priv=%lu svc_unpriv=%lu\r\n",
+                   svcBenchName[call],
+                   (unsigned long)SvcBench_PerCall((SvcBenchCall_t)call, SVC_MODE_DIRECT),
+                   (unsigned long)SvcBench_PerCall((SvcBenchCall_t)call, SVC_MODE_SVC_PRIV),
+                   (unsigned long)SvcBench_PerCall((SvcBenchCall_t)call, SVC_MODE_SVC_UNPRIV));
+        }
+
+        Task_Delay(SVC_BENCH_PERIOD_SECONDS * SYSTICK_FREQ_HZ);
+    }
+}
+
+void tm_main(void)
+{
+    Semaphore_Init(&svcBenchSem, 0);
+    Semaphore_Init(&svcStartSem, 0);
+    Semaphore_Init(&svcDoneSem, 0);
+
+    Task_CreateStatic(&tcb_report, stack_report, sizeof(stack_report),
+                      SvcBench_ReportFunc, "SvcReport", NULL, 0, 0);
+    Task_CreateStatic(&tcb_unpriv, stack_unpriv, sizeof(stack_unpriv),
+                      SvcBench_UnprivFunc, "SvcUnpriv", NULL, 1, 0);
+    Task_SetUnprivileged(&tcb_unpriv);
+}
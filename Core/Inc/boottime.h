@@ -0,0 +1,52 @@
+#ifndef BOOTTIME_H
+#define BOOTTIME_H
+
+#include <stdint.h>
+
+#include "main.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 리셋 -> 첫 태스크 구간별 시간 측정.
+ * Reset_Handler가 맨 처음 DWT->CYCCNT를 0부터 돌리고, 각 단계 끝에서 카운터를 기록한다.
+ * 기록은 .noinit에 두므로 .bss 제로화 전에 찍은 값도 남는다 */
+#ifndef BOOTTIME_ENABLE
+#define BOOTTIME_ENABLE         1
+#endif
+
+/* 순서 변경 금지: 앞의 네 단계는 Core/Startup/startup_stm32f407vgtx.s가 인덱스로 기록
+ * (CubeIDE 스타트업 순서대로 SystemInit은 .data/.bss 다음) */
+typedef enum {
+    BOOT_PHASE_DATA_COPY = 0,       // .data 복사
+    BOOT_PHASE_BSS_ZERO,            // .bss 제로화
+    BOOT_PHASE_SYSTEM_INIT,         // SystemInit (FPU, 벡터 테이블)
+    BOOT_PHASE_CONSTRUCTORS,        // __libc_init_array (정적 생성자)
+    BOOT_PHASE_HAL_INIT,
+    BOOT_PHASE_CLOCK,               // SystemClock_Config (PLL 락 대기 포함)
+    BOOT_PHASE_PERIPHERALS,         // main에 남은 MX_*_Init
+    BOOT_PHASE_KERNEL_INIT,         // Scheduler_Start: 태스크 테이블, 로그/거버너/MPU/SST
+    BOOT_PHASE_FIRST_TASK,          // 첫 컨텍스트 스위치 요청 직전
+    BOOT_PHASE_COUNT
+} BootPhase_t;
+
+extern uint32_t bootStamps[BOOT_PHASE_COUNT];
+
+static inline void BootTime_Mark(BootPhase_t phase)
+{
+#if BOOTTIME_ENABLE
+    bootStamps[phase] = DWT->CYCCNT;
+#else
+    (void)phase;
+#endif
+}
+
+/* 단계별 사이클/us 출력 (printf). 클럭 설정 전 단계는 HSI 기준으로 환산 */
+void BootTime_Report(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,54 @@
+#ifndef CLOCK_H
+#define CLOCK_H
+
+#include "main.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 시스템 클럭 프로파일 - 모두 HSI(16MHz) 기반이라 보드 크리스탈에 의존하지 않음 */
+typedef enum {
+    CLOCK_PROFILE_16MHZ = 0,    // HSI 직결, PLL off
+    CLOCK_PROFILE_48MHZ,
+    CLOCK_PROFILE_84MHZ,
+    CLOCK_PROFILE_168MHZ,       // 최대 성능, Scale 1, 5 WS
+    CLOCK_PROFILE_COUNT
+} ClockProfile_t;
+
+#define CLOCK_PROFILE_DEFAULT   CLOCK_PROFILE_168MHZ
+#define CLOCK_MAX_UARTS         2
+
+typedef struct {
+    const char *name;
+    uint32_t sysclkHz;
+    uint32_t pllState;          // RCC_PLL_ON / RCC_PLL_OFF
+    uint32_t pllN;
+    uint32_t pllP;
+    uint32_t pllQ;
+    uint32_t ahbDivider;
+    uint32_t apb1Divider;
+    uint32_t apb2Divider;
+    uint32_t flashLatency;
+    uint32_t voltageScale;
+} ClockProfileConfig_t;
+
+/* 프로파일 전환. SysTick(커널 틱)과 등록된 UART의 보레이트를 새 클럭에 맞게 재계산.
+ * 인터럽트를 막은 채 수행되므로 수십~수백 us 동안 틱이 지연될 수 있음 */
+HAL_StatusTypeDef Clock_SetProfile(ClockProfile_t profile);
+ClockProfile_t Clock_GetProfile(void);
+const ClockProfileConfig_t *Clock_GetProfileConfig(ClockProfile_t profile);
+
+/* APB1 타이머(TIM2~7, 12~14) 입력 클럭. APB1 분주가 1이 아니면 PCLK1 x2 */
+uint32_t Clock_GetApb1TimerHz(void);
+
+/* 클럭 전환 시 BRR을 다시 계산할 UART 등록 (USART2 등 APB1/APB2 모두 가능) */
+void Clock_RegisterUart(UART_HandleTypeDef *huart);
+/* 등록된 UART의 전송 완료 대기 (클럭 정지/변경 전) */
+void Clock_WaitUartIdle(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef CONSOLE_H
+#define CONSOLE_H
+
+#include "main.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* UART 콘솔 송신: 링 버퍼에 복사 후 DMA로 전송.
+ * 호출한 태스크는 회선(바이트당 87us @115200)이 아니라 버퍼 공간만 기다림 */
+#ifndef CONSOLE_TX_BUFFER_SIZE
+#define CONSOLE_TX_BUFFER_SIZE      1024    // 2의 거듭제곱
+#endif
+
+typedef enum {
+    CONSOLE_OVERFLOW_BLOCK = 0,     // 공간이 날 때까지 호출 태스크 블록
+    CONSOLE_OVERFLOW_DROP           // 넘치는 바이트는 버리고 카운트
+} ConsoleOverflow_t;
+
+#ifndef CONSOLE_OVERFLOW_DEFAULT
+#define CONSOLE_OVERFLOW_DEFAULT    CONSOLE_OVERFLOW_BLOCK
+#endif
+
+/* huart는 HAL_UART_Init 및 hdmatx 링크가 끝난 상태여야 함 */
+void Console_Init(UART_HandleTypeDef *huart);
+/* 반환: 버퍼에 들어간 바이트 수. ISR에서는 정책과 무관하게 drop */
+int  Console_Write(const void *data, uint32_t len);
+/* 블록하지 않는 쓰기 (idle 태스크용): len 전부가 들어갈 자리가 있을 때만 쓰고 len 반환,
+ * 없으면 아무것도 쓰지 않고 0 (drop 카운트에도 넣지 않음) */
+int  Console_TryWrite(const void *data, uint32_t len);
+void Console_SetOverflowPolicy(ConsoleOverflow_t policy);
+uint32_t Console_GetDroppedBytes(void);
+uint32_t Console_GetFreeSpace(void);
+/* 버퍼가 빌 때까지 바쁜 대기 (치명적 오류 출력 후 정지 전 등). 인터럽트가 켜져 있어야 함 */
+void Console_Flush(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
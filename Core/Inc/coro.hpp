@@ -0,0 +1,349 @@
+#ifndef CORO_HPP
+#define CORO_HPP
+
+/* C++20 코루틴 실행 계층.
+ * 커널 태스크 하나(Executor)가 여러 코루틴을 번갈아 실행한다. 코루틴은 자기 스택이 없고
+ * 프레임만 고정 크기 풀(CORO_FRAME_SIZE x CORO_FRAME_COUNT)에서 받으므로 힙을 쓰지 않는다.
+ *
+ *   co::Task flow(co::Queue<Msg, 8> &rx) {
+ *       Msg m = co_await rx.receive();
+ *       co_await co::delay(10);
+ *   }
+ *   executor.spawn(flow(rx));
+ *
+ * 커널 Semaphore_t/Queue_t의 대기 리스트는 TCB를 매달기 때문에 코루틴은 co::Semaphore,
+ * co::Queue 를 기다린다. signal()/send()는 ISR, 일반 태스크, 다른 Executor 어디서나 호출 가능.
+ * 리스트 조작은 커널과 같이 인터럽트를 잠깐 끄고 한다 */
+
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+#include "task.h"
+#include "semaphore.h"
+#include "rtos.hpp"
+
+#ifndef CORO_FRAME_SIZE
+#define CORO_FRAME_SIZE     256     // 8의 배수. 이보다 큰 코루틴은 생성 실패 (Task::valid() == false)
+#endif
+
+#ifndef CORO_FRAME_COUNT
+#define CORO_FRAME_COUNT    32
+#endif
+
+namespace co {
+
+class Executor;
+
+namespace detail {
+
+using IrqLock = rtos::CriticalSection;
+
+struct WaitList;
+
+/* 코루틴 하나의 스케줄링 상태. 각 프레임의 promise에 하나씩 들어 있음 */
+struct Waiter {
+    Waiter *next = nullptr;         // ready 또는 대기 리스트 링크
+    Waiter *timerNext = nullptr;    // Executor 타이머 리스트 링크
+    WaitList *waitList = nullptr;   // 기다리는 중인 리스트 (타임아웃 시 제거용)
+    std::coroutine_handle<> handle; // 다시 실행할 (가장 안쪽) 코루틴
+    Executor *executor = nullptr;
+    uint32_t wakeTick = 0;
+    bool timerArmed = false;
+    bool timedOut = false;
+    void *slot = nullptr;           // 큐 수신 아이템을 넘겨받을 곳
+};
+
+/* FIFO. 인터럽트 비활성 상태에서만 조작 */
+struct WaitList {
+    Waiter *head = nullptr;
+    Waiter *tail = nullptr;
+
+    void push(Waiter *w);
+    Waiter *pop();
+    void remove(Waiter *w);
+};
+
+void *allocFrame(std::size_t size) noexcept;
+void freeFrame(void *frame) noexcept;
+
+/* 대기 중인 코루틴 하나를 깨움 (인터럽트 비활성 상태). 깨운 Executor 반환 */
+Executor *wakeLocked(Waiter *w);
+
+}  // namespace detail
+
+/* 코루틴 반환 타입. Executor::spawn()으로 넘기거나 다른 코루틴에서 co_await 한다 */
+class Task {
+public:
+    struct promise_type;
+    using Handle = std::coroutine_handle<promise_type>;
+
+    struct FinalAwaiter {
+        bool await_ready() const noexcept { return false; }
+        std::coroutine_handle<> await_suspend(Handle h) noexcept;
+        void await_resume() const noexcept {}
+    };
+
+    struct promise_type {
+        detail::Waiter node;
+        std::coroutine_handle<> continuation;   // co_await 한 부모
+        bool detached = false;                  // spawn된 최상위: 끝나면 스스로 해제
+
+        static void *operator new(std::size_t size) noexcept { return detail::allocFrame(size); }
+        static void operator delete(void *frame) noexcept { detail::freeFrame(frame); }
+        static Task get_return_object_on_allocation_failure() noexcept { return Task(nullptr); }
+
+        Task get_return_object() noexcept { return Task(Handle::from_promise(*this)); }
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+        FinalAwaiter final_suspend() const noexcept { return {}; }
+        void return_void() const noexcept {}
+        void unhandled_exception() const noexcept { Task_ExitError(); }
+    };
+
+    Task(Task &&other) noexcept : handle_(other.handle_) { other.handle_ = nullptr; }
+    Task(const Task &) = delete;
+    Task &operator=(const Task &) = delete;
+    ~Task() {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+    /* 프레임 풀이 비었거나 프레임이 CORO_FRAME_SIZE보다 크면 false */
+    bool valid() const noexcept { return static_cast<bool>(handle_); }
+
+    /* 자식 코루틴을 현재 Executor에서 바로 시작하고 끝나면 부모로 복귀 */
+    auto operator co_await() && noexcept {
+        struct Awaiter {
+            Handle child;
+
+            bool await_ready() const noexcept { return !child || child.done(); }
+            std::coroutine_handle<> await_suspend(Handle parent) noexcept {
+                child.promise().continuation = parent;
+                child.promise().node.executor = parent.promise().node.executor;
+                return child;
+            }
+            void await_resume() const noexcept {}
+        };
+        return Awaiter{handle_};
+    }
+
+private:
+    friend class Executor;
+
+    explicit Task(Handle handle) noexcept : handle_(handle) {}
+
+    Handle release() noexcept {
+        Handle h = handle_;
+        handle_ = nullptr;
+        return h;
+    }
+
+    Handle handle_;
+};
+
+/* 커널 태스크 하나 위에서 코루틴들을 실행 */
+class Executor {
+public:
+    Executor();
+
+    /* 반환: false면 task가 유효하지 않음 (프레임 할당 실패) */
+    bool spawn(Task &&task);
+
+    /* 커널 태스크 본문에서 호출 (반환하지 않음) */
+    [[noreturn]] void run();
+
+    /* Task_CreateStatic 진입점. params = Executor* */
+    static void taskEntry(void *params);
+
+    /* 내부용 (인터럽트 비활성 상태) */
+    void makeReadyLocked(detail::Waiter *w);
+    void armTimerLocked(detail::Waiter *w, uint32_t ticks);
+    void disarmTimerLocked(detail::Waiter *w);
+    /* 대기 중인 run()을 깨움 (인터럽트 활성 상태, ISR 가능) */
+    void notify();
+
+private:
+    /* 만료 타이머 처리 + ready 코루틴 실행. 반환: 다음 타이머까지 틱 (0: 바로 다시) */
+    uint32_t poll();
+
+    detail::WaitList ready_;
+    detail::Waiter *timers_ = nullptr;  // 만료 틱 순
+    Semaphore_t wakeSem_;
+    bool waiting_ = false;              // run()이 wakeSem_에서 잠들려 함: 이때만 신호 (토큰 누적 방지)
+};
+
+/* co_await co::delay(ticks) */
+struct DelayAwaiter {
+    uint32_t ticks;
+
+    bool await_ready() const noexcept { return ticks == 0; }
+    void await_suspend(Task::Handle h) noexcept {
+        detail::Waiter &node = h.promise().node;
+        detail::IrqLock lock;
+
+        node.handle = h;
+        node.executor->armTimerLocked(&node, ticks);
+    }
+    void await_resume() const noexcept {}
+};
+
+inline DelayAwaiter delay(uint32_t ticks) noexcept {
+    return DelayAwaiter{ticks};
+}
+
+/* 코루틴용 카운팅 세마포어.
+ * co_await sem;                     무한 대기
+ * bool ok = co_await sem.wait(t);   t 틱 타임아웃 (0이면 즉시) */
+class Semaphore {
+public:
+    explicit Semaphore(uint32_t initialCount = 0) noexcept : count_(initialCount) {}
+    Semaphore(const Semaphore &) = delete;
+    Semaphore &operator=(const Semaphore &) = delete;
+
+    /* ISR/태스크/코루틴 어디서나 */
+    void signal() noexcept;
+    bool tryWait() noexcept;
+
+    class WaitAwaiter {
+    public:
+        WaitAwaiter(Semaphore &sem, uint32_t timeout) noexcept : sem_(sem), timeout_(timeout) {}
+
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(Task::Handle h) noexcept;
+        bool await_resume() const noexcept { return node_ ? !node_->timedOut : acquired_; }
+
+    private:
+        Semaphore &sem_;
+        uint32_t timeout_;
+        detail::Waiter *node_ = nullptr;
+        bool acquired_ = false;
+    };
+
+    WaitAwaiter wait(uint32_t timeout = TASK_WAIT_FOREVER) noexcept { return WaitAwaiter(*this, timeout); }
+    WaitAwaiter operator co_await() noexcept { return wait(); }
+
+private:
+    uint32_t count_;
+    detail::WaitList waiters_;
+};
+
+/* 코루틴용 고정 크기 큐 (아이템은 복사로 전달, 링 버퍼는 객체 안에).
+ * send()는 ISR/태스크/코루틴 어디서나 블록하지 않고, 기다리는 코루틴이 있으면 바로 넘김
+ * T item = co_await q.receive();
+ * std::optional<T> item = co_await q.receive(t);   t 틱 타임아웃 */
+template <typename T, uint32_t N>
+class Queue {
+    static_assert(std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>,
+                  "co::Queue items are copied from interrupts");
+    static_assert(N > 0, "co::Queue needs at least one slot");
+
+public:
+    Queue() noexcept = default;
+    Queue(const Queue &) = delete;
+    Queue &operator=(const Queue &) = delete;
+
+    /* 반환: false면 가득 참 */
+    bool send(const T &item) noexcept {
+        Executor *woken = nullptr;
+        {
+            detail::IrqLock lock;
+            detail::Waiter *w = waiters_.pop();
+
+            if (w != nullptr) {
+                *static_cast<T *>(w->slot) = item;
+                woken = detail::wakeLocked(w);
+            } else if (count_ < N) {
+                items_[(head_ + count_) % N] = item;
+                count_++;
+            } else {
+                return false;
+            }
+        }
+        if (woken != nullptr) {
+            woken->notify();
+        }
+        return true;
+    }
+
+    bool tryReceive(T &item) noexcept {
+        detail::IrqLock lock;
+        return popLocked(item);
+    }
+
+    uint32_t count() const noexcept { return count_; }
+
+    template <bool WithTimeout>
+    class ReceiveAwaiter {
+    public:
+        ReceiveAwaiter(Queue &queue, uint32_t timeout) noexcept : queue_(queue), timeout_(timeout) {}
+
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(Task::Handle h) noexcept {
+            detail::Waiter &node = h.promise().node;
+            detail::IrqLock lock;
+
+            if (queue_.popLocked(item_)) {
+                received_ = true;
+                return false;
+            }
+            if (timeout_ == 0) {
+                return false;
+            }
+
+            node.handle = h;
+            node.slot = &item_;
+            node.timedOut = false;
+            node.waitList = &queue_.waiters_;
+            queue_.waiters_.push(&node);
+            if (timeout_ != TASK_WAIT_FOREVER) {
+                node.executor->armTimerLocked(&node, timeout_);
+            }
+            node_ = &node;
+            return true;
+        }
+        auto await_resume() const noexcept {
+            if constexpr (WithTimeout) {
+                bool ok = node_ ? !node_->timedOut : received_;
+                return ok ? std::optional<T>(item_) : std::nullopt;
+            } else {
+                return item_;
+            }
+        }
+
+    private:
+        Queue &queue_;
+        uint32_t timeout_;
+        T item_{};
+        detail::Waiter *node_ = nullptr;
+        bool received_ = false;
+    };
+
+    ReceiveAwaiter<false> receive() noexcept { return ReceiveAwaiter<false>(*this, TASK_WAIT_FOREVER); }
+    ReceiveAwaiter<true> receive(uint32_t timeout) noexcept { return ReceiveAwaiter<true>(*this, timeout); }
+
+private:
+    bool popLocked(T &item) noexcept {
+        if (count_ == 0) {
+            return false;
+        }
+        item = items_[head_];
+        head_ = (head_ + 1 == N) ? 0 : head_ + 1;
+        count_--;
+        return true;
+    }
+
+    T items_[N]{};
+    uint32_t head_ = 0;
+    uint32_t count_ = 0;
+    detail::WaitList waiters_;
+};
+
+/* 풀에 남은 프레임 수 */
+uint32_t freeFrames() noexcept;
+
+}  // namespace co
+
+#endif
@@ -0,0 +1,39 @@
+#ifndef GOVERNOR_H
+#define GOVERNOR_H
+
+#include "clock.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 부하 기반 클럭/전압 스케일링 (기본 비활성 - 빌드 시 -DGOVERNOR_ENABLE=1) */
+#ifndef GOVERNOR_ENABLE
+#define GOVERNOR_ENABLE             0
+#endif
+
+#define GOVERNOR_WINDOW_TICKS       100     // 부하 측정 구간
+#define GOVERNOR_UP_THRESHOLD       80      // % 이상이면 즉시 최대 클럭
+#define GOVERNOR_DOWN_THRESHOLD     30      // % 미만이 연속되면 한 단계 내림
+#define GOVERNOR_DOWN_WINDOWS       3       // 내리기 전 필요한 연속 저부하 구간 수
+#define GOVERNOR_MIN_PROFILE        CLOCK_PROFILE_16MHZ
+#define GOVERNOR_MAX_PROFILE        CLOCK_PROFILE_168MHZ
+#define GOVERNOR_TASK_PRIORITY      0
+
+void Governor_Init(void);
+/* 틱 회계: 보통 SysTick 마다 ticks=1, 저전력 복귀 시 잠든 틱 수만큼 idle로 */
+void Governor_TickHook(uint8_t idle, uint32_t ticks);
+
+/* 버스트 구간 동안 최소 성능 고정. 요청 즉시 (필요하면) 클럭을 올린 뒤 반환.
+ * Request/Release는 반드시 짝을 맞출 것 */
+void Governor_RequestMinProfile(ClockProfile_t profile);
+void Governor_ReleaseMinProfile(ClockProfile_t profile);
+
+/* 마지막 측정 구간의 부하 (%) */
+uint32_t Governor_GetLoad(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,105 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 지연 바이너리 로그
+ * 호출 지점에서는 포맷 문자열 ID(.log_fmt 섹션 내 오프셋)와 인자 원본(32비트)만
+ * 슬롯에 기록하고, 포맷팅은 idle 태스크(UART 백엔드) 또는 호스트(RTT 백엔드,
+ * Tools/log_decode.py)에서 한다.
+ *
+ * 인자는 모두 uint32_t로 저장: 정수, 포인터, 플래시에 있는 문자열(%s)만 가능.
+ * double, 64비트 정수, RAM 버퍼를 가리키는 %s는 사용 금지 */
+
+#define LOG_LEVEL_DEBUG     0
+#define LOG_LEVEL_INFO      1
+#define LOG_LEVEL_WARN      2
+#define LOG_LEVEL_ERROR     3
+#define LOG_LEVEL_NONE      4
+
+/* 이 레벨 미만의 호출은 컴파일 단계에서 제거 (문자열도 남지 않음) */
+#ifndef LOG_LEVEL_MIN
+#define LOG_LEVEL_MIN       LOG_LEVEL_INFO
+#endif
+
+#define LOG_BACKEND_NONE    0   // 슬롯에만 기록 (디버거로 덤프)
+#define LOG_BACKEND_UART    1   // idle 태스크가 포맷팅해서 콘솔로
+#define LOG_BACKEND_RTT     2   // idle 태스크가 슬롯 원본을 RTT 채널로, 호스트에서 포맷팅
+
+#ifndef LOG_BACKEND
+#define LOG_BACKEND         LOG_BACKEND_UART
+#endif
+
+#ifndef LOG_SLOTS
+#define LOG_SLOTS           64  // 2의 거듭제곱, 슬롯당 32바이트
+#endif
+
+#define LOG_RTT_CHANNEL     1
+#define LOG_MAX_ARGS        6
+
+/* 슬롯 메타 워드: [15:0] 포맷 ID, [18:16] 인자 수, [21:20] 레벨, [31] 기록 완료 */
+#define LOG_META_VALID      0x80000000UL
+
+typedef struct {
+    volatile uint32_t meta;
+    uint32_t timestamp;         // DWT CYCCNT
+    uint32_t args[LOG_MAX_ARGS];
+} LogSlot_t;
+
+extern const char __log_fmt_start[];
+
+void Log_Init(void);
+void Log_Write(uint32_t meta, uint32_t a0, uint32_t a1, uint32_t a2,
+               uint32_t a3, uint32_t a4, uint32_t a5);
+/* 쌓인 슬롯을 백엔드로 내보냄 (블록하지 않음). idle 태스크에서 호출 */
+void Log_Process(void);
+uint32_t Log_GetDropped(void);
+
+/* 내부 매크로 (인자는 최대 LOG_MAX_ARGS개) */
+#define LOG_NARGS_(_0, _1, _2, _3, _4, _5, _6, N, ...) N
+#define LOG_NARGS(...)      LOG_NARGS_(0, ##__VA_ARGS__, 6, 5, 4, 3, 2, 1, 0)
+#define LOG_ARGS_(_z, a, b, c, d, e, f, ...) \
+    (uint32_t)(a), (uint32_t)(b), (uint32_t)(c), (uint32_t)(d), (uint32_t)(e), (uint32_t)(f)
+#define LOG_ARGS(...)       LOG_ARGS_(0, ##__VA_ARGS__, 0, 0, 0, 0, 0, 0)
+
+#define LOG_EMIT(level, fmt, ...) do {                                              \
+        static const char logFmt_[] __attribute__((section(".log_fmt"), used)) = fmt; \
+        Log_Write(((uint32_t)(logFmt_ - __log_fmt_start) & 0xFFFFU)                 \
+                  | ((uint32_t)LOG_NARGS(__VA_ARGS__) << 16)                       \
+                  | ((uint32_t)(level) << 20),                                     \
+                  LOG_ARGS(__VA_ARGS__));                                          \
+    } while (0)
+
+#if LOG_LEVEL_MIN <= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(fmt, ...) LOG_EMIT(LOG_LEVEL_DEBUG, fmt, ##__VA_ARGS__)
+#else
+#define LOG_DEBUG(fmt, ...) do { } while (0)
+#endif
+
+#if LOG_LEVEL_MIN <= LOG_LEVEL_INFO
+#define LOG_INFO(fmt, ...)  LOG_EMIT(LOG_LEVEL_INFO, fmt, ##__VA_ARGS__)
+#else
+#define LOG_INFO(fmt, ...)  do { } while (0)
+#endif
+
+#if LOG_LEVEL_MIN <= LOG_LEVEL_WARN
+#define LOG_WARN(fmt, ...)  LOG_EMIT(LOG_LEVEL_WARN, fmt, ##__VA_ARGS__)
+#else
+#define LOG_WARN(fmt, ...)  do { } while (0)
+#endif
+
+#if LOG_LEVEL_MIN <= LOG_LEVEL_ERROR
+#define LOG_ERROR(fmt, ...) LOG_EMIT(LOG_LEVEL_ERROR, fmt, ##__VA_ARGS__)
+#else
+#define LOG_ERROR(fmt, ...) do { } while (0)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,45 @@
+#ifndef LOWPOWER_H
+#define LOWPOWER_H
+
+#include "main.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* idle 태스크의 STOP 모드 진입 (기본 비활성 - 빌드 시 -DLOWPOWER_STOP_ENABLE=1)
+ * STOP 중에는 SysTick이 멈추므로 RTC(LSI) 웨이크업 타이머로 다음 커널 데드라인에
+ * 깨어나고, RTC 캘린더로 잰 실제 경과 시간만큼 커널 시간을 보정한다 */
+#ifndef LOWPOWER_STOP_ENABLE
+#define LOWPOWER_STOP_ENABLE            0
+#endif
+
+/* STOP 탈출 비용 (레귤레이터 + HSI 기동 + PLL 재잠금 + 클럭 복원) */
+#ifndef LOWPOWER_STOP_EXIT_US
+#define LOWPOWER_STOP_EXIT_US           500
+#endif
+
+/* 시스템이 허용하는 비동기 이벤트(EXTI 등) 응답 지연 기본값.
+ * STOP 탈출 비용이 이보다 크면 WFI만 사용 */
+#ifndef LOWPOWER_WAKE_LATENCY_BUDGET_US
+#define LOWPOWER_WAKE_LATENCY_BUDGET_US 1000
+#endif
+
+/* 이보다 짧게 잘 수 있으면 STOP 진입 손해 (진입/탈출 에너지) */
+#ifndef LOWPOWER_STOP_MIN_SLEEP_US
+#define LOWPOWER_STOP_MIN_SLEEP_US      2000
+#endif
+
+#define LOWPOWER_MAX_SLEEP_MS           30000
+
+void LowPower_Init(void);
+/* idle 태스크 루프에서 호출 - WFI 또는 STOP 중 선택 */
+void LowPower_Idle(void);
+/* 런타임에 허용 지연 변경 (예: 제어 루프 구동 중에는 STOP 금지) */
+void LowPower_SetWakeLatencyBudget(uint32_t us);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -46,6 +46,8 @@ extern "C" {
 
 /* Exported macro ------------------------------------------------------------*/
 /* USER CODE BEGIN EM */
+/* 스타트업에서 복사/제로화하지 않는 RAM (태스크 스택, 트레이스 버퍼) */
+#define NOINIT  __attribute__((section(".noinit")))
 
 /* USER CODE END EM */
 
@@ -0,0 +1,27 @@
+#ifndef MEMPOOL_H
+#define MEMPOOL_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 고정 크기 블록 메모리 풀 - 비어 있는 블록끼리 단일 연결 리스트로 관리 */
+typedef struct {
+    void *freeList;
+    uint32_t blockSize;
+    uint32_t blockCount;
+    volatile uint32_t freeCount;
+} MemPool_t;
+
+/* blockSize는 4바이트 단위로 올림, buffer는 4바이트 정렬 필요 */
+void  MemPool_Init(MemPool_t *pool, void *buffer, uint32_t blockSize, uint32_t blockCount);
+void *MemPool_Alloc(MemPool_t *pool);   // 블록이 없으면 NULL
+void  MemPool_Free(MemPool_t *pool, void *block);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
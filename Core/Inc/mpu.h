@@ -0,0 +1,49 @@
+#ifndef MPU_H
+#define MPU_H
+
+#include "main.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 태스크별 MPU 도메인. PendSV가 다음 태스크의 도메인을 MPU 영역 4~7에 한 번에 로드.
+ * 도메인이 같거나(공유) 도메인이 없는 특권 태스크로 전환하면 리로드를 생략 */
+#ifndef MPU_ENABLE
+#define MPU_ENABLE              0
+#endif
+
+#define MPU_DOMAIN_REGIONS      4
+#define MPU_TASK_REGION_FIRST   4   // 0~3: 커널 고정 영역 (0: Flash)
+
+typedef enum {
+    MPU_ACCESS_RW = 0,      // 스택, 전용 데이터 (실행 금지)
+    MPU_ACCESS_RO,          // 비특권은 읽기만 (공유 설정값 등)
+    MPU_ACCESS_DEVICE       // 주변장치 레지스터
+} MpuAccess_t;
+
+/* RBAR/RASR 쌍 4개: PendSV가 RBAR~RASR_A3 별칭 레지스터에 그대로 8워드 저장 */
+typedef struct {
+    ARM_MPU_Region_t regions[MPU_DOMAIN_REGIONS];
+} MpuDomain_t;
+
+/* 모든 영역을 비활성으로 초기화 */
+void Mpu_InitDomain(MpuDomain_t *domain);
+/* size는 32바이트 이상 2의 거듭제곱, base는 size 정렬이어야 함
+ * 반환: 0 성공, -1 잘못된 인자 */
+int  Mpu_SetRegion(MpuDomain_t *domain, uint32_t index, const void *base,
+                   uint32_t size, MpuAccess_t access);
+/* 커널 고정 영역 설정 후 MPU 활성화 (PRIVDEFENA: 특권은 기본 메모리 맵 사용) */
+void Mpu_Init(void);
+/* MemManage 폴트가 비특권 태스크에서 났으면 그 태스크만 정지시키고 1 반환 */
+uint8_t Mpu_HandleFault(void);
+uint32_t Mpu_GetFaultCount(void);
+
+/* PendSV가 현재 로드된 도메인과 비교 */
+extern const MpuDomain_t *mpuActiveDomain;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef MUTEX_H
+#define MUTEX_H
+
+#include <stdint.h>
+
+#include "task.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 재귀 뮤텍스 + 1단계 우선순위 상속.
+ * 소유자가 대기자보다 낮은 우선순위면 Unlock까지 대기자 우선순위로 올림 */
+#define MUTEX_MAGIC         0x4D555458UL    // "MUTX": Init 여부 (시스템 콜 핸들 검사)
+
+typedef struct {
+    TCB_t *owner;
+    uint32_t nesting;
+    TCB_t *waitListHead;
+    uint32_t magic;
+} Mutex_t;
+
+#define MUTEX_INITIALIZER   { NULL, 0, NULL, MUTEX_MAGIC }
+
+void Mutex_Init(Mutex_t *mutex);
+/* timeout: 틱 단위, TASK_WAIT_FOREVER면 무한 대기
+ * 반환: 0 획득, -1 타임아웃.
+ * 스케줄러 시작 전에는 경쟁이 없으므로 아무것도 하지 않고 0. ISR에서 호출 금지 */
+int  Mutex_Lock(Mutex_t *mutex, uint32_t timeout);
+void Mutex_Unlock(Mutex_t *mutex);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
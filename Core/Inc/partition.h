@@ -0,0 +1,73 @@
+#ifndef PARTITION_H
+#define PARTITION_H
+
+#include "main.h"
+#include "lowpower.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ARINC-653 스타일 시간 분할 (기본 비활성 - 빌드 시 -DPARTITION_ENABLE=1)
+ * 메이저 프레임을 시간 창 목록으로 나누고, 창마다 한 파티션의 태스크만 실행 가능.
+ * 파티션 안에서는 기존 우선순위 스케줄링 그대로. 창 경계는 하드웨어 타이머(TIM5) 업데이트
+ * 인터럽트가 정하고, 다음 창 길이는 ARR 프리로드로 미리 넣어 두므로 경계에 소프트웨어 지터가
+ * 없음. 전환 비용은 ISR + 태스크 리스트 한 번 스캔 + PendSV 한 번으로 상한이 있음.
+ *
+ * 파티션 0(PARTITION_SYSTEM)은 모든 창에서 실행 가능: idle 태스크와 커널 서비스용.
+ * 다른 파티션 시간을 빼앗으므로 응용 태스크를 두지 말 것 */
+#ifndef PARTITION_ENABLE
+#define PARTITION_ENABLE            0
+#endif
+
+/* idle(파티션 0)이 STOP에 들어가면 TIM5가 멈추고, 잠드는 길이도 창 경계를 모름:
+ * 메이저 프레임이 조용히 늘어나므로 같이 쓰지 않음 */
+#if PARTITION_ENABLE && LOWPOWER_STOP_ENABLE
+#error "PARTITION_ENABLE cannot be combined with LOWPOWER_STOP_ENABLE"
+#endif
+
+#define PARTITION_SYSTEM            0
+#define PARTITION_MAX_WINDOWS       8
+
+/* 창 타이머: 32비트 TIM5 (1MHz로 카운트) */
+#ifndef PARTITION_TIMER
+#define PARTITION_TIMER             TIM5
+#define PARTITION_TIMER_IRQn        TIM5_IRQn
+#define PARTITION_TIMER_IRQHandler  TIM5_IRQHandler
+#define PARTITION_TIMER_CLK_ENABLE() __HAL_RCC_TIM5_CLK_ENABLE()
+#endif
+
+/* 창 경계가 다른 장치 ISR에 밀리지 않도록 높게 */
+#ifndef PARTITION_TIMER_NVIC_PRIORITY
+#define PARTITION_TIMER_NVIC_PRIORITY   1
+#endif
+
+typedef struct {
+    uint8_t partition;      // 이 창에서 실행할 파티션 (창을 비우려면 쓰지 않는 ID)
+    uint32_t durationUs;
+} PartitionWindow_t;
+
+extern volatile uint8_t partitionActive;
+
+/* 메이저 프레임 설정 (Scheduler_Start 전에). windows는 호출 후에도 유지되는 저장소.
+ * 반환: 0 성공, -1 잘못된 인자 */
+int  Partition_SetSchedule(const PartitionWindow_t *windows, uint32_t count);
+/* 첫 창을 활성화하고 타이머 시작 (Scheduler_Start에서 호출) */
+void Partition_Init(void);
+/* 현재 타이머 클럭에 맞춰 1MHz 프리스케일러 재계산 (클럭 변경 후, 다음 창부터 적용) */
+void Partition_ConfigureTimer(void);
+
+/* 창 전환 횟수와 마지막 전환 ISR 진입 시각 (DWT->CYCCNT). 전환 지연 측정용 */
+uint32_t Partition_GetSwitchCount(void);
+uint32_t Partition_GetSwitchStamp(void);
+
+static inline uint8_t Partition_IsActive(uint8_t partition)
+{
+    return partition == PARTITION_SYSTEM || partition == partitionActive;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,39 @@
+#ifndef QUEUE_H
+#define QUEUE_H
+
+#include <stdint.h>
+
+#include "task.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define QUEUE_MAGIC         0x51554555UL    // "QUEU": Init 여부 (시스템 콜 핸들 검사)
+
+/* 고정 크기 메시지 큐 (아이템은 복사로 전달) */
+typedef struct {
+    uint8_t *buffer;
+    uint32_t itemSize;
+    uint32_t capacity;
+    uint32_t head;
+    uint32_t tail;
+    volatile uint32_t count;
+    TCB_t *sendWaitList;  // 공간을 기다리는 송신자
+    TCB_t *recvWaitList;  // 데이터를 기다리는 수신자
+    uint32_t magic;
+} Queue_t;
+
+/* buffer는 itemSize * capacity 바이트 이상이어야 함 */
+void Queue_Init(Queue_t *queue, void *buffer, uint32_t itemSize, uint32_t capacity);
+/* timeout 규칙은 Semaphore_Wait와 동일. ISR에서는 timeout 0으로만 호출
+ * 반환: 0 성공, -1 타임아웃 */
+int  Queue_Send(Queue_t *queue, const void *item, uint32_t timeout);
+int  Queue_Receive(Queue_t *queue, void *item, uint32_t timeout);
+uint32_t Queue_Count(const Queue_t *queue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
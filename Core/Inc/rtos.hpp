@@ -0,0 +1,165 @@
+#ifndef RTOS_HPP
+#define RTOS_HPP
+
+/* C 커널 API를 감싸는 헤더 전용 C++ 래퍼.
+ * 버퍼와 크기를 객체가 직접 가지므로 크기/정렬 실수가 컴파일 타임에 걸린다.
+ * 멤버 함수는 전부 인라인 한 줄이라 C API를 직접 부른 것과 같은 코드가 나온다.
+ *
+ *   static rtos::StaticTask<256> worker;
+ *   static rtos::Queue<Msg, 8> rx;
+ *   static rtos::Mutex lock;
+ *
+ *   worker.start(Worker_Func, "Worker", nullptr, 2);
+ *   { rtos::LockGuard guard(lock); ... }
+ *
+ * 전역 객체로 두는 것을 전제로 함: Queue/Semaphore는 정적 생성자에서 Init,
+ * StaticTask는 start()에서 Task_CreateStatic (스케줄러 시작 전).
+ * 런타임 생성이 필요 없는 태스크는 task.h의 TASK_DEFINE (C++에서는 constinit으로 검사) */
+
+#include <cstdint>
+#include <type_traits>
+
+#include "task.h"
+#include "semaphore.h"
+#include "queue.h"
+#include "mutex.h"
+
+namespace rtos {
+
+constexpr uint32_t TaskMinStackWords = TASK_MIN_STACK_WORDS;
+
+/* TCB와 스택을 멤버로 가진 태스크. StackWords는 32비트 워드 수 */
+template <uint32_t StackWords>
+class StaticTask {
+    static_assert(StackWords >= TaskMinStackWords, "task stack too small");
+    static_assert(StackWords % 2 == 0, "stack top must stay 8-byte aligned (AAPCS)");
+
+public:
+    constexpr StaticTask() noexcept = default;
+    StaticTask(const StaticTask &) = delete;
+    StaticTask &operator=(const StaticTask &) = delete;
+
+    void start(TaskFunction_t func, const char *name, void *params, uint8_t priority,
+               uint32_t timeSlice = 0) noexcept {
+        Task_CreateStatic(&tcb_, stack_, sizeof(stack_), func, name, params, priority, timeSlice);
+    }
+
+    /* deadline 0이면 period와 같음 (Task_SetPeriod) */
+    void setPeriod(uint32_t period, uint32_t deadline = 0) noexcept { Task_SetPeriod(&tcb_, period, deadline); }
+    /* 반환: 이전 임계값 (Task_SetPreemptThreshold) */
+    uint8_t setPreemptThreshold(uint8_t threshold) noexcept { return Task_SetPreemptThreshold(&tcb_, threshold); }
+    void suspend() noexcept { Task_Suspend(&tcb_); }
+    void resume() noexcept { Task_Resume(&tcb_); }
+    /* start() 이후, 처음 실행되기 전에 */
+    void setUnprivileged() noexcept { Task_SetUnprivileged(&tcb_); }
+#if MPU_ENABLE
+    void setMpuDomain(const MpuDomain_t *domain) noexcept { Task_SetMpuDomain(&tcb_, domain); }
+#endif
+
+    TCB_t *tcb() noexcept { return &tcb_; }
+    static constexpr uint32_t stackBytes() noexcept { return sizeof(uint32_t) * StackWords; }
+
+private:
+    TCB_t tcb_{};
+    alignas(8) uint32_t stack_[StackWords]{};
+};
+
+class Semaphore {
+public:
+    explicit Semaphore(int32_t initialCount = 0) noexcept { Semaphore_Init(&sem_, initialCount); }
+    Semaphore(const Semaphore &) = delete;
+    Semaphore &operator=(const Semaphore &) = delete;
+
+    /* timeout 규칙은 Semaphore_Wait와 동일. 반환: false면 타임아웃 */
+    bool wait(uint32_t timeout = TASK_WAIT_FOREVER) noexcept { return Semaphore_Wait(&sem_, timeout) == 0; }
+    void signal() noexcept { Semaphore_Signal(&sem_); }
+
+    Semaphore_t *native() noexcept { return &sem_; }
+
+private:
+    Semaphore_t sem_;
+};
+
+/* 아이템 타입과 용량이 고정된 큐. 저장 공간은 객체 안에 */
+template <typename T, uint32_t N>
+class Queue {
+    static_assert(std::is_trivially_copyable_v<T>, "Queue_t copies items with memcpy");
+    static_assert(N > 0, "queue needs at least one slot");
+
+public:
+    Queue() noexcept { Queue_Init(&queue_, storage_, sizeof(T), N); }
+    Queue(const Queue &) = delete;
+    Queue &operator=(const Queue &) = delete;
+
+    /* timeout 규칙은 Queue_Send/Queue_Receive와 동일. 반환: false면 타임아웃 */
+    bool send(const T &item, uint32_t timeout = TASK_WAIT_FOREVER) noexcept {
+        return Queue_Send(&queue_, &item, timeout) == 0;
+    }
+    bool receive(T &item, uint32_t timeout = TASK_WAIT_FOREVER) noexcept {
+        return Queue_Receive(&queue_, &item, timeout) == 0;
+    }
+
+    uint32_t count() const noexcept { return Queue_Count(&queue_); }
+    static constexpr uint32_t capacity() noexcept { return N; }
+
+    Queue_t *native() noexcept { return &queue_; }
+
+private:
+    Queue_t queue_;
+    T storage_[N];
+};
+
+/* 재귀 + 우선순위 상속 뮤텍스. 상수 초기화되므로 정적 생성자 없음 */
+class Mutex {
+public:
+    constexpr Mutex() noexcept = default;
+    Mutex(const Mutex &) = delete;
+    Mutex &operator=(const Mutex &) = delete;
+
+    /* 반환: false면 타임아웃 */
+    bool lock(uint32_t timeout = TASK_WAIT_FOREVER) noexcept { return Mutex_Lock(&mutex_, timeout) == 0; }
+    void unlock() noexcept { Mutex_Unlock(&mutex_); }
+
+    Mutex_t *native() noexcept { return &mutex_; }
+
+private:
+    Mutex_t mutex_ = MUTEX_INITIALIZER;
+};
+
+/* 스코프 동안 뮤텍스 보유. 타임아웃을 주면 owns()로 획득 여부 확인 */
+class LockGuard {
+public:
+    /* 무한 대기는 실패하지 않으므로 결과 검사 없음 */
+    explicit LockGuard(Mutex &mutex) noexcept : mutex_(mutex), owns_(true) { mutex.lock(); }
+    LockGuard(Mutex &mutex, uint32_t timeout) noexcept : mutex_(mutex), owns_(mutex.lock(timeout)) {}
+    ~LockGuard() {
+        if (owns_) {
+            mutex_.unlock();
+        }
+    }
+    LockGuard(const LockGuard &) = delete;
+    LockGuard &operator=(const LockGuard &) = delete;
+
+    bool owns() const noexcept { return owns_; }
+    explicit operator bool() const noexcept { return owns_; }
+
+private:
+    Mutex &mutex_;
+    bool owns_;
+};
+
+/* 스코프 동안 인터럽트 비활성 (중첩 가능) */
+class CriticalSection {
+public:
+    CriticalSection() noexcept : primask_(__get_PRIMASK()) { __disable_irq(); }
+    ~CriticalSection() { __set_PRIMASK(primask_); }
+    CriticalSection(const CriticalSection &) = delete;
+    CriticalSection &operator=(const CriticalSection &) = delete;
+
+private:
+    uint32_t primask_;
+};
+
+}  // namespace rtos
+
+#endif
@@ -0,0 +1,35 @@
+#ifndef RTT_CHANNEL_H
+#define RTT_CHANNEL_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* RTT up-buffer를 태스크/서브시스템별로 할당.
+ * 0: 터미널(printf), 1: 로그(LOG_RTT_CHANNEL)는 고정, 나머지를 동적으로 나눠 줌 */
+#define RTT_CHANNEL_FIRST_DYNAMIC   2
+
+typedef enum {
+    RTT_CHANNEL_EXCLUSIVE = 0,  // 쓰는 주체가 하나: 락 없이 기록
+    RTT_CHANNEL_SHARED          // 여러 태스크가 공유: 커널 뮤텍스로 직렬화 (인터럽트 마스크 없음)
+} RttChannelMode_t;
+
+/* buffer는 채널 수명 동안 유지되어야 함.
+ * EXCLUSIVE 채널을 태스크에서 열면 그 태스크가 소유자가 되고, 스케줄러 시작 전(main)에 열면
+ * 소유자 검사 없이 단일 writer로 간주
+ * 반환: 채널 번호, 남은 up-buffer가 없으면 -1 */
+int RttChannel_Open(const char *name, void *buffer, uint32_t size, RttChannelMode_t mode);
+/* 공간이 부족하면 통째로 버리고 카운트 (SEGGER_RTT_MODE_NO_BLOCK_SKIP).
+ * SHARED 채널은 태스크에서만 쓸 수 있음: ISR에서 부르면 drop
+ * 반환: 기록한 바이트 수. 열리지 않은 채널이거나 소유자가 아닌 태스크가 EXCLUSIVE 채널에 쓰면 -1 */
+int RttChannel_Write(int channel, const void *data, uint32_t len);
+/* 열리지 않은 채널이면 0 */
+uint32_t RttChannel_GetDropped(int channel);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
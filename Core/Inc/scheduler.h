@@ -10,6 +10,60 @@ extern "C" {
 #define MAX_PRIORITY_LEVELS     8
 #define SYSTICK_FREQ_HZ         1000
 
+/* SCHEDULER_EDF (task.h): 이 우선순위 레벨에서 주기가 설정된 태스크(Task_SetPeriod)는
+ * 라운드 로빈 대신 절대 데드라인(releaseTick + deadline)이 이른 순으로 실행.
+ * 레디 EDF 태스크는 이진 힙에 있어 삽입/제거 O(log n), 선택 O(1).
+ * 더 높은 레벨은 그대로 선점하고, 낮은 레벨은 고정 우선순위 백그라운드 클래스.
+ * 같은 레벨의 주기 없는 태스크나 우선순위 상속으로 올라온 뮤텍스 소유자는 EDF 잡보다 먼저 */
+#ifndef SCHEDULER_EDF_PRIORITY
+#define SCHEDULER_EDF_PRIORITY  0
+#endif
+
+#ifndef SCHEDULER_EDF_MAX_TASKS
+#define SCHEDULER_EDF_MAX_TASKS 16
+#endif
+
+/* SCHEDULER_FAIR (task.h): 이 우선순위 레벨의 태스크는 라운드 로빈 대신 가중치(Task_SetWeight)에
+ * 비례해 CPU를 받음. 실행 사이클(DWT)을 가중치로 환산한 vruntime이 가장 작은 태스크가 실행되고,
+ * 레디 태스크는 vruntime 최소 힙에 있어 선택 O(1). 청구와 재선택은 스케줄링 시점에 일어나므로
+ * 이 레벨 태스크는 타임 슬라이스를 켜 둘 것 (timeSlice가 분배 단위) */
+#ifndef SCHEDULER_FAIR_PRIORITY
+#define SCHEDULER_FAIR_PRIORITY 1
+#endif
+
+#ifndef SCHEDULER_FAIR_MAX_TASKS
+#define SCHEDULER_FAIR_MAX_TASKS 16
+#endif
+
+#define SCHEDULER_FAIR_WEIGHT_DEFAULT   100
+
+/* SCHEDULER_SLICE_CYCLES (task.h): 실행 중인 태스크의 남은 슬라이스(사이클)만큼 원샷 타이머를
+ * 걸어 두고, 스위치 때 실제 실행 사이클만 청구. 틱 직전에 블록하는 태스크도 쓴 만큼 내고,
+ * 슬라이스 도중 선점/블록되면 남은 양을 다음 실행에 이어서 씀. 만료 인터럽트 우선순위는 SysTick과 같음.
+ * 긴 슬라이스도 프리스케일러 없이 세려면 32비트 타이머가 필요한데 TIM5는 파티션 창 타이머라 TIM2.
+ * TIM2_IRQHandler를 가져가므로 TIM2를 직접 쓰는 코드와는 같이 빌드하지 말 것 */
+#ifndef SCHEDULER_SLICE_TIMER
+#define SCHEDULER_SLICE_TIMER_IS_TIM2       1
+#define SCHEDULER_SLICE_TIMER               TIM2
+#define SCHEDULER_SLICE_TIMER_IRQn          TIM2_IRQn
+#define SCHEDULER_SLICE_TIMER_IRQHandler    TIM2_IRQHandler
+#define SCHEDULER_SLICE_TIMER_CLK_ENABLE()  __HAL_RCC_TIM2_CLK_ENABLE()
+#endif
+
+/* SCHEDULER_BUDGET (task.h): TASK_BUDGET_DEMOTE 태스크가 보충 때까지 내려가는 레벨 (idle 바로 위) */
+#ifndef SCHEDULER_BUDGET_DEMOTE_PRIORITY
+#define SCHEDULER_BUDGET_DEMOTE_PRIORITY    (MAX_PRIORITY_LEVELS - 2)
+#endif
+
+#if SCHEDULER_EDF && SCHEDULER_FAIR && SCHEDULER_EDF_PRIORITY == SCHEDULER_FAIR_PRIORITY
+#error "SCHEDULER_EDF_PRIORITY and SCHEDULER_FAIR_PRIORITY must differ"
+#endif
+
+/* 레디 힙 루트가 비활성 파티션일 수 있어 같이 쓰지 않음 */
+#if PARTITION_ENABLE && (SCHEDULER_EDF || SCHEDULER_FAIR)
+#error "PARTITION_ENABLE cannot be combined with SCHEDULER_EDF or SCHEDULER_FAIR"
+#endif
+
 /* 전역 변수 - 반드시 extern 선언 */
 extern TCB_t *currentTask;
 extern TCB_t *nextTask;
@@ -20,8 +74,59 @@ void Scheduler_AddTask(TCB_t *tcb);
 void Scheduler_Schedule(void);
 void Scheduler_Start(void);
 void Scheduler_ContextSwitch(void);
+void Scheduler_ConfigureTick(void);
+uint8_t Scheduler_IsIdleTask(const TCB_t *tcb);
 TCB_t *Scheduler_GetHighestPriorityTask(void);
 
+#if SCHEDULER_EDF || SCHEDULER_FAIR
+/* 인터럽트 비활성 상태에서 호출. 힙 대상(EDF/공정 분배 레벨)이 아니거나 이미 힙에 있으면 무시 */
+void Scheduler_ReadyHeapInsert(TCB_t *tcb);
+void Scheduler_ReadyHeapRemove(TCB_t *tcb);
+#endif
+
+#if TASK_CYCLE_ACCOUNTING
+/* 실행 중인 태스크에 마지막 청구 이후의 DWT 사이클을 청구 (인터럽트 비활성 상태) */
+void Scheduler_ChargeRunning(TCB_t *tcb);
+#endif
+
+#if SCHEDULER_SLICE_CYCLES
+/* 현재 슬라이스를 다 쓴 것으로 처리 (Task_Yield, 만료 인터럽트). 다음 스케줄에서 교대 */
+void Scheduler_ExpireSlice(TCB_t *tcb);
+#endif
+
+#if SCHEDULER_BUDGET
+/* 인터럽트 비활성 상태에서 호출. 반환: 태스크가 다시 실행 가능해졌으면 1 */
+uint8_t Scheduler_BudgetReplenish(TCB_t *tcb, uint32_t now);   // 보충 시각이면 예산을 채움
+uint8_t Scheduler_BudgetRestore(TCB_t *tcb);                   // 소진 조치 해제
+#endif
+
+/* task.c의 상태 전환 훅 (인터럽트 비활성 상태): READY가 됨 / READY·RUNNING에서 빠짐.
+ * TaskReady가 실행 중인 태스크를 예산 소진으로 보류(SUSPENDED)하면 호출자가 Scheduler_Schedule */
+static inline void Scheduler_TaskReady(TCB_t *tcb)
+{
+#if SCHEDULER_BUDGET
+    // 블록 중에 예산이 소진된 정지 대상: 깨어나도 보충 때까지 보류
+    if (tcb->budgetExhausted && tcb->budgetAction == TASK_BUDGET_SUSPEND) {
+        tcb->state = TASK_STATE_SUSPENDED;
+        return;
+    }
+#endif
+#if SCHEDULER_EDF || SCHEDULER_FAIR
+    Scheduler_ReadyHeapInsert(tcb);
+#else
+    (void)tcb;
+#endif
+}
+
+static inline void Scheduler_TaskUnready(TCB_t *tcb)
+{
+    // 블록/정지하면 잡이 끝난 것: 다음 디스패치 전까지는 원래 우선순위로 경쟁
+    tcb->thresholdHeld = 0;
+#if SCHEDULER_EDF || SCHEDULER_FAIR
+    Scheduler_ReadyHeapRemove(tcb);
+#endif
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -9,13 +9,26 @@
 
 #include "task.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SEMAPHORE_MAGIC     0x53454D41UL    // "SEMA": Init 여부 (시스템 콜 핸들 검사)
+
 typedef struct {
     volatile int32_t count;
     TCB_t *waitListHead;  // 대기 중인 태스크들
+    uint32_t magic;
 } Semaphore_t;
 
 void Semaphore_Init(Semaphore_t *sem, int32_t initialCount);
+/* timeout: 틱 단위, 0이면 즉시 반환, TASK_WAIT_FOREVER면 무한 대기
+ * 반환: 0 획득, -1 타임아웃 */
 int  Semaphore_Wait(Semaphore_t *sem, uint32_t timeout);
 void Semaphore_Signal(Semaphore_t *sem);
 
-#endif
\ No newline at end of file
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef SST_H
+#define SST_H
+
+#include <stdint.h>
+
+#include "main.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 스택을 공유하는 run-to-completion 태스크 (Super-Simple-Tasker 방식).
+ * 우선순위 레벨마다 안 쓰는 NVIC 인터럽트 하나를 배정하고, 이벤트를 보내면 그 레벨을
+ * pend 한다. 선점/복귀는 NVIC가 처리하므로 전환 비용은 인터럽트 진입/복귀뿐이고
+ * 모든 핸들러가 MSP 하나를 같이 쓴다 (TCB도, 태스크별 스택도 없음).
+ *
+ * 핸들러는 ISR 문맥에서 돌기 때문에 모든 TCB 태스크보다 우선하며 블록하면 안 됨
+ * (커널 API는 ISR과 같은 규칙: timeout 0, Signal/Submit 등만) */
+
+#define SST_LEVELS              4
+
+/* 레벨 0이 가장 낮음. NVIC 우선순위는 하드웨어 ISR(0~9)보다 낮고 SysTick/PendSV(15)보다 높게 */
+#ifndef SST_NVIC_PRIORITY_BASE
+#define SST_NVIC_PRIORITY_BASE  13      // 레벨 n -> NVIC 우선순위 13 - n
+#endif
+
+/* 레벨별로 빌려 쓰는 인터럽트 (이 펌웨어에서 쓰지 않는 CAN2) */
+#ifndef SST_LEVEL0_IRQn
+#define SST_LEVEL0_IRQn         CAN2_TX_IRQn
+#define SST_LEVEL0_IRQHandler   CAN2_TX_IRQHandler
+#define SST_LEVEL1_IRQn         CAN2_RX0_IRQn
+#define SST_LEVEL1_IRQHandler   CAN2_RX0_IRQHandler
+#define SST_LEVEL2_IRQn         CAN2_RX1_IRQn
+#define SST_LEVEL2_IRQHandler   CAN2_RX1_IRQHandler
+#define SST_LEVEL3_IRQn         CAN2_SCE_IRQn
+#define SST_LEVEL3_IRQHandler   CAN2_SCE_IRQHandler
+#endif
+
+typedef void (*SstHandler_t)(void *context, uint32_t event);
+
+typedef struct SstTask {
+    SstHandler_t handler;
+    void *context;
+    uint32_t *events;           // 이벤트 링 버퍼 (호출자 저장소)
+    uint8_t capacity;
+    uint8_t head;
+    volatile uint8_t count;
+    uint8_t level;
+    uint8_t queued;             // ready 리스트에 있거나 실행 중
+    struct SstTask *readyNext;  // 레벨별 ready FIFO 링크
+} SstTask_t;
+
+/* 레벨 인터럽트 우선순위 설정 및 활성화 (Scheduler_Start에서 호출) */
+void Sst_Init(void);
+/* level: 0 ~ SST_LEVELS-1, eventBuffer는 capacity개 이상 */
+void Sst_TaskInit(SstTask_t *task, SstHandler_t handler, void *context, uint8_t level,
+                  uint32_t *eventBuffer, uint8_t capacity);
+/* ISR/태스크/SST 핸들러 어디서나 호출 가능. 반환: 0 성공, -1 큐 가득 참 */
+int  Sst_Post(SstTask_t *task, uint32_t event);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
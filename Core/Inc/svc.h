@@ -0,0 +1,139 @@
+#ifndef SVC_H
+#define SVC_H
+
+#include <stdint.h>
+
+#include "task.h"
+#include "semaphore.h"
+#include "queue.h"
+#include "mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 시스템 콜 번호 = svc 명령 즉치값 = svcTable 인덱스 */
+#define SVC_TASK_DELAY          0
+#define SVC_TASK_YIELD          1
+#define SVC_TASK_GET_TICK_COUNT 2
+#define SVC_SEMAPHORE_WAIT      3
+#define SVC_SEMAPHORE_SIGNAL    4
+#define SVC_QUEUE_SEND          5
+#define SVC_QUEUE_RECEIVE       6
+#define SVC_MUTEX_LOCK          7
+#define SVC_MUTEX_UNLOCK        8
+#define SVC_CONSOLE_WRITE       9
+#define SVC_GET_CYCLES          10
+#define SVC_TASK_DELAY_UNTIL    11
+#define SVC_TASK_WAIT_PERIOD    12
+#define SVC_COUNT               13
+
+#ifndef __ASSEMBLER__
+
+typedef void (*SvcFunction_t)(void);
+/* 특권 호출자는 svcTable의 커널 함수로 바로, 비특권 호출자는 svcUserTable의 검사 래퍼로.
+ * 래퍼는 복사 없이 범위만 검사하고 위반이면 -1 (반환값이 없는 호출은 무시):
+ *   포인터/길이: 호출 태스크가 직접 닿는 메모리 (스택, MPU 도메인 영역, 읽기는 Flash).
+ *               도메인이 없는 태스크는 SRAM/CCM 전체 (이미 직접 쓸 수 있는 범위)
+ *   커널 객체:   *_Init/MUTEX_INITIALIZER로 초기화돼 매직 워드가 맞고,
+ *               호출 태스크가 쓸 수 있는 메모리(스택, RW 영역) 밖에 있어야 함 */
+extern const SvcFunction_t svcTable[SVC_COUNT];
+extern const SvcFunction_t svcUserTable[SVC_COUNT];
+
+/* 인자는 레지스터(R0-R3)로 그대로 전달되고 커널 함수는 호출 태스크의 스택에서 실행됨.
+ * 일반 함수 호출처럼 R0-R3, R12, LR은 파괴됨. ISR에서 호출 금지 */
+#define SVC_CALL(num, a0, a1, a2)                                           \
+    __extension__({                                                         \
+        register uint32_t svcR0 __asm("r0") = (uint32_t)(a0);               \
+        register uint32_t svcR1 __asm("r1") = (uint32_t)(a1);               \
+        register uint32_t svcR2 __asm("r2") = (uint32_t)(a2);               \
+        register uint32_t svcR3 __asm("r3");                                \
+        __asm volatile ("svc %[n]"                                          \
+                        : "+r" (svcR0), "+r" (svcR1), "+r" (svcR2),         \
+                          "=r" (svcR3)                                      \
+                        : [n] "I" (num)                                     \
+                        : "r12", "lr", "cc", "memory");                     \
+        (void)svcR3;                                                        \
+        svcR0;                                                              \
+    })
+
+/* 비특권 태스크용 커널 API. 특권 태스크에서 불러도 동작함 (직접 호출보다 느림) */
+static inline void Sys_Delay(uint32_t ticks)
+{
+    (void)SVC_CALL(SVC_TASK_DELAY, ticks, 0, 0);
+}
+
+static inline int Sys_DelayUntil(uint32_t *lastWakeTick, uint32_t period)
+{
+    return (int)SVC_CALL(SVC_TASK_DELAY_UNTIL, lastWakeTick, period, 0);
+}
+
+static inline int Sys_WaitForNextPeriod(void)
+{
+    return (int)SVC_CALL(SVC_TASK_WAIT_PERIOD, 0, 0, 0);
+}
+
+static inline void Sys_Yield(void)
+{
+    (void)SVC_CALL(SVC_TASK_YIELD, 0, 0, 0);
+}
+
+static inline uint32_t Sys_GetTickCount(void)
+{
+    return SVC_CALL(SVC_TASK_GET_TICK_COUNT, 0, 0, 0);
+}
+
+static inline int Sys_SemaphoreWait(Semaphore_t *sem, uint32_t timeout)
+{
+    return (int)SVC_CALL(SVC_SEMAPHORE_WAIT, sem, timeout, 0);
+}
+
+static inline void Sys_SemaphoreSignal(Semaphore_t *sem)
+{
+    (void)SVC_CALL(SVC_SEMAPHORE_SIGNAL, sem, 0, 0);
+}
+
+static inline int Sys_QueueSend(Queue_t *queue, const void *item, uint32_t timeout)
+{
+    return (int)SVC_CALL(SVC_QUEUE_SEND, queue, item, timeout);
+}
+
+static inline int Sys_QueueReceive(Queue_t *queue, void *item, uint32_t timeout)
+{
+    return (int)SVC_CALL(SVC_QUEUE_RECEIVE, queue, item, timeout);
+}
+
+static inline int Sys_MutexLock(Mutex_t *mutex, uint32_t timeout)
+{
+    return (int)SVC_CALL(SVC_MUTEX_LOCK, mutex, timeout, 0);
+}
+
+static inline void Sys_MutexUnlock(Mutex_t *mutex)
+{
+    (void)SVC_CALL(SVC_MUTEX_UNLOCK, mutex, 0, 0);
+}
+
+static inline int Sys_ConsoleWrite(const void *data, uint32_t len)
+{
+    return (int)SVC_CALL(SVC_CONSOLE_WRITE, data, len, 0);
+}
+
+/* DWT CYCCNT (비특권에서는 직접 읽을 수 없음) */
+static inline uint32_t Sys_GetCycles(void)
+{
+    return SVC_CALL(SVC_GET_CYCLES, 0, 0, 0);
+}
+
+/* 현재 Thread mode가 비특권인지 (CONTROL은 비특권에서도 읽을 수 있음) */
+static inline uint8_t Sys_IsUnprivileged(void)
+{
+    return (__get_CONTROL() & CONTROL_nPRIV_Msk) != 0U;
+}
+
+#endif /* __ASSEMBLER__ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -3,6 +3,42 @@
 
 #include "main.h"
 
+/* 태스크마다 newlib struct _reent (errno, stdio 상태, strtok 등)를 두고
+ * 컨텍스트 스위치 때 _impure_ptr을 교체 */
+#ifndef TASK_NEWLIB_REENT
+#define TASK_NEWLIB_REENT       1
+#endif
+
+#if TASK_NEWLIB_REENT
+#include <reent.h>
+#endif
+
+#include "mpu.h"
+#include "partition.h"
+
+/* 주기 태스크를 절대 데드라인 순으로 스케줄 (scheduler.h의 SCHEDULER_EDF_PRIORITY 레벨) */
+#ifndef SCHEDULER_EDF
+#define SCHEDULER_EDF           0
+#endif
+
+/* 한 우선순위 레벨 안에서 가중치에 비례해 CPU 분배 (scheduler.h의 SCHEDULER_FAIR_PRIORITY 레벨) */
+#ifndef SCHEDULER_FAIR
+#define SCHEDULER_FAIR          0
+#endif
+
+/* 태스크별 실행 예산(DWT 사이클)과 보충 주기. 소진하면 보충 때까지 강등 또는 정지 (Task_SetBudget) */
+#ifndef SCHEDULER_BUDGET
+#define SCHEDULER_BUDGET        0
+#endif
+
+/* 타임 슬라이스를 틱 단위 대신 DWT 사이클로 청구하고, 만료는 원샷 타이머 비교로 (scheduler.h) */
+#ifndef SCHEDULER_SLICE_CYCLES
+#define SCHEDULER_SLICE_CYCLES  0
+#endif
+
+/* 스위치마다 실행 사이클을 청구하는 기능이 하나라도 켜져 있음 */
+#define TASK_CYCLE_ACCOUNTING   (SCHEDULER_FAIR || SCHEDULER_BUDGET || SCHEDULER_SLICE_CYCLES)
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -14,6 +50,12 @@ typedef enum {
     TASK_STATE_SUSPENDED
 } TaskState_t;
 
+/* 예산 소진 시 조치 */
+typedef enum {
+    TASK_BUDGET_DEMOTE = 0,    // SCHEDULER_BUDGET_DEMOTE_PRIORITY로 내려서 남는 CPU만 사용
+    TASK_BUDGET_SUSPEND        // 보충 때까지 실행하지 않음
+} TaskBudgetAction_t;
+
 typedef struct TCB {
     uint32_t *stackPointer;
     uint32_t *stackBase;
@@ -23,23 +65,174 @@ typedef struct TCB {
     const char *name;
     uint8_t priority;
     uint8_t basePriority;
+    uint8_t preemptThreshold;  // 실행 중 이 값보다 높은(작은) 우선순위에게만 선점됨. 기본은 priority
+    uint8_t thresholdHeld;     // 디스패치된 뒤 블록/양보 전: 선점돼도 임계값 레벨에서 경쟁
     TaskState_t state;
     uint32_t delayTicks;
-    uint32_t timeSlice;
-    uint32_t timeSliceRemain;
+    uint32_t timeSlice;        // 같은 우선순위 교대 단위 (틱). 0: 타임 슬라이싱 없음
+    uint32_t timeSliceRemain;  // 틱 청구 방식에서 남은 틱 (SCHEDULER_SLICE_CYCLES면 안 씀)
     struct TCB *next;
+    struct TCB *waitNext;      // 세마포어/큐 대기 리스트 링크
+    struct TCB **waitList;     // 들어가 있는 대기 리스트 헤드 (없으면 NULL)
+    int32_t waitResult;        // 0: 깨어남(획득), -1: 타임아웃
+    uint32_t control;          // 스위치 시 저장/복원하는 CONTROL.nPRIV (0: 특권, 1: 비특권)
+    uint32_t period;           // 주기 태스크 (Task_SetPeriod). 0: 주기 없음
+    uint32_t deadline;         // 릴리스 기준 상대 데드라인 (틱)
+    uint32_t releaseTick;      // 현재 잡의 릴리스 시각
+    uint32_t deadlineMisses;
+    uint32_t overruns;         // 다음 릴리스 시각이 지난 뒤에야 잡이 끝난 횟수
+    uint8_t jobMissed;         // 현재 잡의 데드라인 미스를 이미 셌음
+#if SCHEDULER_EDF || SCHEDULER_FAIR
+    uint8_t heapSlot;          // 레디 힙(EDF/공정 분배) 위치 + 1 (0: 힙 밖)
+#endif
+#if TASK_CYCLE_ACCOUNTING
+    uint32_t runStartCycles;   // 마지막으로 청구한(실행을 시작한) DWT->CYCCNT
+#endif
+#if SCHEDULER_SLICE_CYCLES
+    uint32_t sliceUsedCycles;  // 현재 슬라이스에서 쓴 사이클 (블록/선점돼도 이어서 셈)
+#endif
+#if SCHEDULER_FAIR
+    uint32_t vruntime;         // 가중치로 환산한 누적 실행 사이클. 작은 태스크가 먼저
+    uint32_t fairInvWeight;    // 2^16 * 기본 가중치 / weight (Task_SetWeight). 0: 기본 가중치
+#endif
+#if SCHEDULER_BUDGET
+    uint32_t budgetUs;         // 설정 값. 클럭 변경 때 budgetCycles를 다시 환산
+    uint32_t budgetCycles;     // 보충 주기당 예산 (현재 SystemCoreClock 기준). 0: 예산 없음
+    uint32_t budgetRemain;
+    uint32_t budgetPeriod;     // 보충 주기 (틱)
+    uint32_t budgetReplenishTick;
+    uint32_t budgetExhaustions;
+    uint8_t budgetAction;      // TaskBudgetAction_t
+    uint8_t budgetExhausted;   // 소진 조치 중 (보충 때 해제)
+    uint8_t userSuspended;     // Task_Suspend로 정지됨. 예산 정지와 따로 관리 (보충이 깨우지 않음)
+#endif
+#if PARTITION_ENABLE
+    uint8_t partition;         // 시간 분할 파티션 ID. 0: 시스템 (모든 창에서 실행)
+#endif
+#if MPU_ENABLE
+    const MpuDomain_t *mpuDomain;  // NULL: 도메인 없음 (특권 태스크)
+#endif
+#if TASK_NEWLIB_REENT
+    struct _reent reent;
+#endif
 } TCB_t;
 
 typedef void (*TaskFunction_t)(void *);
 
+#define TASK_WAIT_FOREVER       0xFFFFFFFFUL
+
+/* 초기 예외 프레임(하드웨어 8 + R4-R11 8) 워드 수와 스택 최소 크기 */
+#define TASK_INITIAL_FRAME_WORDS    16
+#define TASK_MIN_STACK_WORDS        64
+
+#ifdef __cplusplus
+#define TASK_STATIC_ASSERT(cond, msg)   static_assert(cond, msg)
+#define TASK_CONSTINIT                  constinit
+#else
+#define TASK_STATIC_ASSERT(cond, msg)   _Static_assert(cond, msg)
+#define TASK_CONSTINIT
+#endif
+
+/* 정적 태스크 정의. TCB와 스택을 컴파일 타임에 채워 두고 .task_table 섹션에 포인터를 등록.
+ * Scheduler_Start가 테이블을 한 번 훑어 초기 프레임만 쓰고 리스트에 연결한다
+ * (memset/필드 대입/Scheduler_AddTask 없음). 스택은 .noinit이라 부팅 때 제로화하지 않음.
+ * 파일 스코프에서만 사용.
+ *   TASK_DEFINE(tcb_sensor, "Sensor", Sensor_Func, NULL, 2, 10, 256);
+ * 다른 파일에서 TCB가 필요하면 TASK_DECLARE(tcb_sensor) */
+#define TASK_DEFINE(tcb_, name_, func_, params_, priority_, timeSlice_, stackWords_)          \
+    TASK_STATIC_ASSERT((stackWords_) >= TASK_MIN_STACK_WORDS && (stackWords_) % 2 == 0,     \
+                       "task stack must be >= TASK_MIN_STACK_WORDS and an even word count"); \
+    static NOINIT uint32_t tcb_##_stack[stackWords_] __attribute__((aligned(8)));          \
+    TASK_CONSTINIT TCB_t tcb_ = {                                                           \
+        .stackPointer = &tcb_##_stack[(stackWords_) - TASK_INITIAL_FRAME_WORDS],            \
+        .stackBase = tcb_##_stack,                                                          \
+        .stackSize = sizeof(uint32_t) * (stackWords_),                                      \
+        .taskFunc = (func_),                                                                \
+        .params = (params_),                                                                \
+        .name = (name_),                                                                    \
+        .priority = (priority_),                                                            \
+        .basePriority = (priority_),                                                        \
+        .preemptThreshold = (priority_),                                                    \
+        .state = TASK_STATE_READY,                                                          \
+        .delayTicks = 0,                                                                    \
+        .timeSlice = (timeSlice_),                                                          \
+        .timeSliceRemain = (timeSlice_),                                                    \
+    };                                                                                      \
+    static TCB_t *const tcb_##_entry __attribute__((section(".task_table"), used)) = &tcb_
+
+#define TASK_DECLARE(tcb_)      extern TCB_t tcb_
+
 void Task_CreateStatic(TCB_t *tcb, uint32_t *stackBuffer, uint32_t stackSizeBytes,
                        TaskFunction_t taskFunc, const char *name, void *params,
                        uint8_t priority, uint32_t timeSlice);
+/* TASK_DEFINE로 정의된 TCB의 초기 프레임/reent 설정 (Scheduler_Start가 호출) */
+void Task_InitDefined(TCB_t *tcb);
 void Task_Delay(uint32_t ticks);
+/* *lastWakeTick + period 시각까지 대기하고 *lastWakeTick을 그 시각으로 갱신.
+ * 실행 시간과 무관하게 릴리스 간격이 누적 오차 없이 유지됨.
+ * 반환: 0 대기함, -1 이미 지난 시각이라 바로 반환 (오버런) */
+int  Task_DelayUntil(uint32_t *lastWakeTick, uint32_t period);
+/* 주기/데드라인(틱) 설정. deadline 0이면 period와 같음. 현재 틱이 첫 릴리스.
+ * 데드라인 미스는 틱마다 검사(SysTick 문맥)하고, 오버런은 Task_WaitForNextPeriod에서 검사 */
+void Task_SetPeriod(TCB_t *tcb, uint32_t period, uint32_t deadline);
+/* 현재 잡 완료: 다음 릴리스까지 대기. 반환: 0 정상, -1 오버런 (대기 없이 바로 다음 잡) */
+int  Task_WaitForNextPeriod(void);
+/* weak 훅. 미스 훅은 SysTick/저전력 복귀 경로에서도 불리므로 ISR 규칙(블록 금지, 짧게),
+ * 오버런 훅은 해당 태스크 문맥 */
+void Task_DeadlineMissHook(TCB_t *tcb);
+void Task_OverrunHook(TCB_t *tcb);
 void Task_Yield(void);
 void Task_StartScheduler(void);
 void Task_TickHandler(void);
 void Task_ExitError(void);
+/* 태스크를 비특권 모드로 실행 (처음 실행되기 전에 호출).
+ * 비특권 태스크는 커널 API를 svc.h의 Sys_* 로만 호출해야 함 */
+void Task_SetUnprivileged(TCB_t *tcb);
+#if MPU_ENABLE
+/* 처음 실행되기 전에 호출. 같은 도메인을 여러 태스크가 가리키면 그 사이 전환은 리로드 없음.
+ * 도메인이 없는 태스크는 직전 도메인을 그대로 쓰므로 비특권 태스크는 반드시 지정.
+ * 도메인을 가진 비특권 태스크는 newlib 상태(.data의 _impure_ptr, TCB의 reent, 힙)에 닿지 못하므로
+ * printf/errno/malloc 등 newlib 호출 금지: 출력은 Sys_ConsoleWrite로 직접.
+ * 어기면 그 접근에서 MemManage가 나고 Mpu_HandleFault가 그 태스크만 정지시킴 */
+void Task_SetMpuDomain(TCB_t *tcb, const MpuDomain_t *domain);
+#endif
+#if PARTITION_ENABLE
+/* 태스크를 파티션에 배정 (처음 실행되기 전에). 그 파티션의 창에서만 실행됨 */
+void Task_SetPartition(TCB_t *tcb, uint8_t partition);
+#endif
+/* 선점 임계값 설정 (priority보다 낮은 값은 priority로 맞춤). 반환: 이전 임계값.
+ * 실행을 시작한 태스크는 블록하거나 Task_Yield할 때까지 임계값을 우선순위로 삼는다.
+ * 더 높은 태스크에게 선점돼 READY로 있는 동안에도 마찬가지라, 그 사이 임계값 이하의
+ * 태스크가 먼저 실행되지 않음. 따라서 같은 임계값을 가진 태스크들은 서로 선점하지 않는다
+ * (데이터 공유에 락 불필요, 최악 스택 사용량이 겹치지 않음). 타임 슬라이스 교대도
+ * 임계값 위의 태스크에게만 넘어가고, Task_Yield는 임계값을 내려놓고 원래 우선순위로 양보 */
+uint8_t Task_SetPreemptThreshold(TCB_t *tcb, uint8_t threshold);
+#if SCHEDULER_BUDGET
+/* 실행 예산 설정: periodTicks마다 budgetUs(SystemCoreClock 기준으로 사이클 환산, 클럭 프로파일이
+ * 바뀌면 Scheduler_ConfigureTick이 다시 환산)로 보충.
+ * 실행 시간은 DWT 사이클로 스위치마다 청구하고, 소진 검사는 스위치와 틱마다 하므로
+ * 초과량은 최대 1틱. 강등 중 뮤텍스 상속으로 올라간 우선순위는 유지됨.
+ * budgetUs 0이면 예산 해제 (소진 조치 중이었으면 즉시 복귀) */
+void Task_SetBudget(TCB_t *tcb, uint32_t budgetUs, uint32_t periodTicks, TaskBudgetAction_t action);
+#endif
+#if SCHEDULER_FAIR
+/* SCHEDULER_FAIR_PRIORITY 레벨에서의 CPU 몫. 같은 레벨 태스크끼리 weight 비율로 나눔
+ * (기본 SCHEDULER_FAIR_WEIGHT_DEFAULT, 0은 1로 취급) */
+void Task_SetWeight(TCB_t *tcb, uint16_t weight);
+#endif
+/* 대기 리스트에서 블록 중이던 태스크는 리스트에서 빠지고, 재개되면 대기 함수가 -1 반환 */
+void Task_Suspend(TCB_t *tcb);
+void Task_Resume(TCB_t *tcb);
+uint32_t Task_GetTickCount(void);
+/* 저전력 모드용: 다음 지연 만료까지 남은 틱 (없으면 TASK_WAIT_FOREVER),
+ * 틱이 멈춰 있던 동안의 경과 시간 반영 */
+uint32_t Task_GetTicksToNextWake(void);
+void Task_AdvanceTicks(uint32_t ticks);
+
+/* 커널 오브젝트용 대기 리스트 (인터럽트 비활성 상태에서 호출) */
+void Task_AddToWaitList(TCB_t **listHead, TCB_t *tcb, uint32_t timeout);
+void Task_RemoveFromWaitList(TCB_t **listHead, TCB_t *tcb);
+TCB_t *Task_WakeFromWaitList(TCB_t **listHead);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,43 @@
+#ifndef UART_RX_H
+#define UART_RX_H
+
+#include "main.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* UART 수신: DMA 순환 모드 + IDLE 라인 감지 (HAL_UARTEx_ReceiveToIdle_DMA).
+ * 바이트마다가 아니라 버스트(프레임)마다 인터럽트 한 번, 긴 스트림은 반 버퍼(HT/TC)마다 한 번.
+ * 프레임은 복사 없이 DMA 버퍼를 가리키는 디스크립터로 태스크에 전달된다.
+ * 전달된 프레임은 채워진 절반 안에 있으므로 DMA가 다른 절반을 채우는 동안 유효하다 */
+#ifndef UART_RX_BUFFER_SIZE
+#define UART_RX_BUFFER_SIZE         1024    // 2의 거듭제곱
+#endif
+
+#ifndef UART_RX_FRAME_QUEUE_DEPTH
+#define UART_RX_FRAME_QUEUE_DEPTH   8
+#endif
+
+/* 순환 버퍼 끝에서 잘린 프레임은 두 조각 (wrapLength == 0 이면 한 조각) */
+typedef struct {
+    const uint8_t *data;
+    uint16_t length;
+    uint16_t wrapLength;
+    const uint8_t *wrapData;
+    uint32_t start;             // 수신 바이트 누적 카운터 기준 시작 위치
+} UartRxFrame_t;
+
+void UartRx_Init(UART_HandleTypeDef *huart);
+/* timeout 규칙은 Queue_Receive와 동일. 반환: 0 수신, -1 타임아웃 */
+int  UartRx_Receive(UartRxFrame_t *frame, uint32_t timeout);
+/* 프레임 처리 완료. DMA가 한 바퀴 돌아 데이터를 덮어썼으면 -1
+ * (버퍼 크기만큼 더 수신되기 전에 처리를 끝내야 함) */
+int  UartRx_Release(const UartRxFrame_t *frame);
+uint32_t UartRx_GetDroppedFrames(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
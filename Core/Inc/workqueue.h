@@ -0,0 +1,59 @@
+#ifndef WORKQUEUE_H
+#define WORKQUEUE_H
+
+#include <stdint.h>
+
+#include "task.h"
+#include "semaphore.h"
+#include "mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 인터럽트의 후처리를 워커 태스크로 넘기는 작업 큐.
+ * Work_t는 호출자 저장소에 두고(할당 없음) ISR에서 lock-free로 제출 */
+
+typedef void (*WorkHandler_t)(void *context);
+
+struct WorkQueue;
+
+typedef struct Work {
+    struct Work *next;
+    WorkHandler_t handler;
+    void *context;
+    volatile uint32_t pending;  // 1: 큐 또는 지연 리스트에 있음 (중복 제출 무시)
+    uint8_t delayed;            // 지연 리스트에 있음
+    struct WorkQueue *queue;    // 지연 작업의 대상 큐
+    uint32_t expiry;            // 지연 작업 만료 틱
+} Work_t;
+
+typedef struct WorkQueue {
+    Work_t *volatile incoming;  // 제출된 작업 (LIFO, LDREX/STREX로 push)
+    Work_t *readyHead;          // 워커가 꺼내는 FIFO (incoming을 뒤집어 옮김)
+    Mutex_t lock;               // readyHead 보호 (워커끼리만)
+    Semaphore_t pendingCount;   // 제출된 작업 수
+} WorkQueue_t;
+
+void WorkQueue_Init(WorkQueue_t *queue);
+/* 큐를 처리할 워커 태스크 생성. 여러 번 부르면 워커가 여러 개 (같은/다른 우선순위) */
+void WorkQueue_StartWorker(WorkQueue_t *queue, TCB_t *tcb, uint32_t *stack,
+                           uint32_t stackSizeBytes, const char *name, uint8_t priority);
+
+void Work_Init(Work_t *work, WorkHandler_t handler, void *context);
+/* ISR/태스크 어디서나 호출 가능. 반환: 1 제출됨, 0 이미 대기 중 */
+int  Work_Submit(WorkQueue_t *queue, Work_t *work);
+/* ticks 뒤에 queue로 제출 (커널 틱에서 만료 처리). 반환은 Work_Submit과 동일 */
+int  Work_SubmitDelayed(WorkQueue_t *queue, Work_t *work, uint32_t ticks);
+/* 아직 만료되지 않은 지연 작업 취소. 반환: 1 취소됨, 0 지연 중이 아님 */
+int  Work_CancelDelayed(Work_t *work);
+
+/* 커널 내부용: 틱마다 만료된 지연 작업 제출, 저전력 모드의 다음 깨어날 시점 계산 */
+void WorkQueue_TickHandler(void);
+uint32_t WorkQueue_GetTicksToNextExpiry(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
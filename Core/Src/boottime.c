@@ -0,0 +1,32 @@
+#include "boottime.h"
+#include <stdio.h>
+
+/* startup 코드가 .bss 제로화 전에 쓰므로 .noinit */
+NOINIT uint32_t bootStamps[BOOT_PHASE_COUNT];
+
+#if BOOTTIME_ENABLE
+static const char *const bootPhaseName[BOOT_PHASE_COUNT] = {
+    "data copy", "bss zero", "SystemInit", "constructors", "HAL_Init",
+    "clock config", "peripherals", "kernel init", "first task"
+};
+#endif
+
+void BootTime_Report(void)
+{
+#if BOOTTIME_ENABLE
+    uint32_t prev = 0;
+    uint32_t totalUs = 0;
+
+    for (uint32_t i = 0; i < BOOT_PHASE_COUNT; i++) {
+        uint32_t cycles = bootStamps[i] - prev;
+        uint32_t mhz = ((i <= BOOT_PHASE_CLOCK) ? HSI_VALUE : SystemCoreClock) / 1000000U;
+        uint32_t us = cycles / mhz;
+
+        printf("boot %-12s %8lu cyc %6lu us\r\n", bootPhaseName[i],
+               (unsigned long)cycles, (unsigned long)us);
+        totalUs += us;
+        prev = bootStamps[i];
+    }
+    printf("boot reset->first task %lu us\r\n", (unsigned long)totalUs);
+#endif
+}
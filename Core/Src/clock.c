@@ -0,0 +1,158 @@
+#include "clock.h"
+#include "scheduler.h"
+
+#define CLOCK_PLLM_HSI          16U     // HSI 16MHz -> VCO 입력 1MHz
+#define CLOCK_UART_IDLE_TIMEOUT 100000U
+
+/* F407, VDD 2.7~3.6V 기준 대기 사이클 / APB1 <= 42MHz, APB2 <= 84MHz
+ * Scale 2 는 HCLK 144MHz 까지 */
+static const ClockProfileConfig_t clockProfiles[CLOCK_PROFILE_COUNT] = {
+    [CLOCK_PROFILE_16MHZ] = {
+        "16MHz", 16000000U, RCC_PLL_OFF, 0, 0, 0,
+        RCC_SYSCLK_DIV1, RCC_HCLK_DIV1, RCC_HCLK_DIV1,
+        FLASH_LATENCY_0, PWR_REGULATOR_VOLTAGE_SCALE2
+    },
+    [CLOCK_PROFILE_48MHZ] = {
+        "48MHz", 48000000U, RCC_PLL_ON, 192, RCC_PLLP_DIV4, 4,
+        RCC_SYSCLK_DIV1, RCC_HCLK_DIV2, RCC_HCLK_DIV1,
+        FLASH_LATENCY_1, PWR_REGULATOR_VOLTAGE_SCALE2
+    },
+    [CLOCK_PROFILE_84MHZ] = {
+        "84MHz", 84000000U, RCC_PLL_ON, 336, RCC_PLLP_DIV4, 7,
+        RCC_SYSCLK_DIV1, RCC_HCLK_DIV2, RCC_HCLK_DIV1,
+        FLASH_LATENCY_2, PWR_REGULATOR_VOLTAGE_SCALE2
+    },
+    [CLOCK_PROFILE_168MHZ] = {
+        "168MHz", 168000000U, RCC_PLL_ON, 336, RCC_PLLP_DIV2, 7,
+        RCC_SYSCLK_DIV1, RCC_HCLK_DIV4, RCC_HCLK_DIV2,
+        FLASH_LATENCY_5, PWR_REGULATOR_VOLTAGE_SCALE1
+    },
+};
+
+static ClockProfile_t clockProfile = CLOCK_PROFILE_16MHZ;
+static UART_HandleTypeDef *clockUarts[CLOCK_MAX_UARTS];
+static uint8_t clockUartCount = 0;
+
+void Clock_RegisterUart(UART_HandleTypeDef *huart)
+{
+    if (clockUartCount < CLOCK_MAX_UARTS) {
+        clockUarts[clockUartCount++] = huart;
+    }
+}
+
+ClockProfile_t Clock_GetProfile(void)
+{
+    return clockProfile;
+}
+
+const ClockProfileConfig_t *Clock_GetProfileConfig(ClockProfile_t profile)
+{
+    return &clockProfiles[profile];
+}
+
+uint32_t Clock_GetApb1TimerHz(void)
+{
+    uint32_t hz = HAL_RCC_GetPCLK1Freq();
+
+    if ((RCC->CFGR & RCC_CFGR_PPRE1) != RCC_CFGR_PPRE1_DIV1) {
+        hz *= 2U;
+    }
+    return hz;
+}
+
+/* 전송 중인 바이트가 깨지지 않도록 시프트 레지스터가 빌 때까지 대기 */
+void Clock_WaitUartIdle(void)
+{
+    for (uint8_t i = 0; i < clockUartCount; i++) {
+        uint32_t timeout = CLOCK_UART_IDLE_TIMEOUT;
+        while ((clockUarts[i]->Instance->SR & USART_SR_TC) == 0 && --timeout);
+    }
+}
+
+static void Clock_UpdateUarts(void)
+{
+    for (uint8_t i = 0; i < clockUartCount; i++) {
+        UART_HandleTypeDef *huart = clockUarts[i];
+        uint32_t pclk = (huart->Instance == USART1 || huart->Instance == USART6)
+                        ? HAL_RCC_GetPCLK2Freq() : HAL_RCC_GetPCLK1Freq();
+
+        if (huart->Init.OverSampling == UART_OVERSAMPLING_8) {
+            huart->Instance->BRR = UART_BRR_SAMPLING8(pclk, huart->Init.BaudRate);
+        } else {
+            huart->Instance->BRR = UART_BRR_SAMPLING16(pclk, huart->Init.BaudRate);
+        }
+    }
+}
+
+HAL_StatusTypeDef Clock_SetProfile(ClockProfile_t profile)
+{
+    const ClockProfileConfig_t *cfg = &clockProfiles[profile];
+    RCC_OscInitTypeDef osc = {0};
+    RCC_ClkInitTypeDef clk = {0};
+    HAL_StatusTypeDef status = HAL_OK;
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    Clock_WaitUartIdle();
+
+    // 1. PLL을 다시 설정하려면 먼저 SYSCLK를 HSI로 옮겨야 함
+    clk.ClockType = RCC_CLOCKTYPE_HCLK | RCC_CLOCKTYPE_SYSCLK
+                  | RCC_CLOCKTYPE_PCLK1 | RCC_CLOCKTYPE_PCLK2;
+    clk.SYSCLKSource = RCC_SYSCLKSOURCE_HSI;
+    clk.AHBCLKDivider = RCC_SYSCLK_DIV1;
+    clk.APB1CLKDivider = RCC_HCLK_DIV1;
+    clk.APB2CLKDivider = RCC_HCLK_DIV1;
+    if (__HAL_RCC_GET_SYSCLK_SOURCE() != RCC_SYSCLKSOURCE_STATUS_HSI) {
+        status = HAL_RCC_ClockConfig(&clk, __HAL_FLASH_GET_LATENCY());
+    }
+
+    // 2. PLL off 상태에서만 VOS 변경 가능
+    osc.OscillatorType = RCC_OSCILLATORTYPE_HSI;
+    osc.HSIState = RCC_HSI_ON;
+    osc.HSICalibrationValue = RCC_HSICALIBRATION_DEFAULT;
+    osc.PLL.PLLState = RCC_PLL_OFF;
+    if (status == HAL_OK) {
+        status = HAL_RCC_OscConfig(&osc);
+    }
+
+    __HAL_RCC_PWR_CLK_ENABLE();
+    __HAL_PWR_VOLTAGESCALING_CONFIG(cfg->voltageScale);
+
+    // 3. 새 PLL 설정
+    if (status == HAL_OK && cfg->pllState == RCC_PLL_ON) {
+        osc.OscillatorType = RCC_OSCILLATORTYPE_NONE;
+        osc.PLL.PLLState = RCC_PLL_ON;
+        osc.PLL.PLLSource = RCC_PLLSOURCE_HSI;
+        osc.PLL.PLLM = CLOCK_PLLM_HSI;
+        osc.PLL.PLLN = cfg->pllN;
+        osc.PLL.PLLP = cfg->pllP;
+        osc.PLL.PLLQ = cfg->pllQ;
+        status = HAL_RCC_OscConfig(&osc);
+    }
+
+    // 4. SYSCLK 전환 (대기 사이클 증감 순서는 HAL이 처리)
+    if (status == HAL_OK) {
+        clk.SYSCLKSource = (cfg->pllState == RCC_PLL_ON) ? RCC_SYSCLKSOURCE_PLLCLK
+                                                         : RCC_SYSCLKSOURCE_HSI;
+        clk.AHBCLKDivider = cfg->ahbDivider;
+        clk.APB1CLKDivider = cfg->apb1Divider;
+        clk.APB2CLKDivider = cfg->apb2Divider;
+        status = HAL_RCC_ClockConfig(&clk, cfg->flashLatency);
+    }
+
+    if (status == HAL_OK) {
+        clockProfile = profile;
+    }
+
+    // ART 가속기: 프리페치 + I/D 캐시
+    __HAL_FLASH_PREFETCH_BUFFER_ENABLE();
+    __HAL_FLASH_INSTRUCTION_CACHE_ENABLE();
+    __HAL_FLASH_DATA_CACHE_ENABLE();
+
+    // 5. 실패해도 현재 실제 클럭(SystemCoreClock)에 맞춰 틱/UART 재계산
+    Scheduler_ConfigureTick();
+    Clock_UpdateUarts();
+
+    __set_PRIMASK(primask);
+    return status;
+}
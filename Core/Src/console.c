@@ -0,0 +1,161 @@
+#include "console.h"
+#include "scheduler.h"
+#include "task.h"
+#include <string.h>
+
+#define CONSOLE_TX_MASK     (CONSOLE_TX_BUFFER_SIZE - 1U)
+
+static UART_HandleTypeDef *consoleUart = NULL;
+static NOINIT uint8_t consoleTxBuffer[CONSOLE_TX_BUFFER_SIZE];
+static volatile uint32_t consoleTxHead = 0;    // 쓰기 위치 (free-running)
+static volatile uint32_t consoleTxTail = 0;    // DMA가 읽을 위치
+static volatile uint32_t consoleTxDmaLen = 0;  // 전송 중인 바이트 수
+static volatile uint32_t consoleDropped = 0;
+static volatile ConsoleOverflow_t consolePolicy = CONSOLE_OVERFLOW_DEFAULT;
+static TCB_t *consoleWriteWaitList = NULL;
+
+void Console_Init(UART_HandleTypeDef *huart)
+{
+    consoleUart = huart;
+}
+
+void Console_SetOverflowPolicy(ConsoleOverflow_t policy)
+{
+    consolePolicy = policy;
+}
+
+uint32_t Console_GetDroppedBytes(void)
+{
+    return consoleDropped;
+}
+
+uint32_t Console_GetFreeSpace(void)
+{
+    return CONSOLE_TX_BUFFER_SIZE - (consoleTxHead - consoleTxTail);
+}
+
+void Console_Flush(void)
+{
+    while (consoleTxHead != consoleTxTail);
+}
+
+/* 인터럽트 비활성 상태에서 호출. 링 끝까지의 연속 구간 하나를 DMA로 전송 */
+static void Console_StartDma(void)
+{
+    uint32_t tail, len;
+
+    if (consoleTxDmaLen != 0 || consoleTxHead == consoleTxTail) {
+        return;
+    }
+
+    tail = consoleTxTail & CONSOLE_TX_MASK;
+    len = consoleTxHead - consoleTxTail;
+    if (len > CONSOLE_TX_BUFFER_SIZE - tail) {
+        len = CONSOLE_TX_BUFFER_SIZE - tail;
+    }
+
+    if (HAL_UART_Transmit_DMA(consoleUart, &consoleTxBuffer[tail], (uint16_t)len) == HAL_OK) {
+        consoleTxDmaLen = len;
+    }
+}
+
+/* 인터럽트 비활성 상태에서 호출. n은 남은 공간 이하 */
+static void Console_CopyIn(const uint8_t *src, uint32_t n)
+{
+    uint32_t head = consoleTxHead & CONSOLE_TX_MASK;
+    uint32_t first = CONSOLE_TX_BUFFER_SIZE - head;
+
+    if (first > n) first = n;
+
+    memcpy(&consoleTxBuffer[head], src, first);
+    memcpy(&consoleTxBuffer[0], &src[first], n - first);
+    consoleTxHead += n;
+
+    Console_StartDma();
+}
+
+int Console_TryWrite(const void *data, uint32_t len)
+{
+    int written = 0;
+
+    if (consoleUart == NULL) {
+        return 0;
+    }
+
+    // 공간 확인과 복사를 한 임계 구역에서: 확인 뒤 다른 태스크가 공간을 채워도 블록하지 않음
+    __disable_irq();
+    if (CONSOLE_TX_BUFFER_SIZE - (consoleTxHead - consoleTxTail) >= len) {
+        Console_CopyIn((const uint8_t *)data, len);
+        written = (int)len;
+    }
+    __enable_irq();
+
+    return written;
+}
+
+int Console_Write(const void *data, uint32_t len)
+{
+    const uint8_t *src = (const uint8_t *)data;
+    uint32_t written = 0;
+    uint8_t inIsr = (__get_IPSR() != 0);
+
+    if (consoleUart == NULL) {
+        return 0;
+    }
+
+    while (written < len) {
+        __disable_irq();
+
+        uint32_t space = CONSOLE_TX_BUFFER_SIZE - (consoleTxHead - consoleTxTail);
+
+        if (space == 0) {
+            if (consolePolicy == CONSOLE_OVERFLOW_DROP || inIsr) {
+                consoleDropped += len - written;
+                __enable_irq();
+                break;
+            }
+            if (currentTask == NULL) {
+                // 스케줄러 시작 전: DMA 완료 인터럽트가 공간을 비울 때까지 대기
+                __enable_irq();
+                continue;
+            }
+            Task_AddToWaitList(&consoleWriteWaitList, currentTask, TASK_WAIT_FOREVER);
+            __enable_irq();
+            Scheduler_Schedule();
+            continue;
+        }
+
+        uint32_t n = len - written;
+
+        if (n > space) n = space;
+        Console_CopyIn(&src[written], n);
+        written += n;
+        __enable_irq();
+    }
+
+    return (int)written;
+}
+
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+    uint8_t woken = 0;
+
+    if (huart != consoleUart) {
+        return;
+    }
+
+    __disable_irq();
+    consoleTxTail += consoleTxDmaLen;
+    consoleTxDmaLen = 0;
+
+    while (Task_WakeFromWaitList(&consoleWriteWaitList) != NULL) {
+        woken = 1;
+    }
+
+    Console_StartDma();
+    __enable_irq();
+
+    if (woken) {
+        Scheduler_Schedule();
+    }
+}
@@ -0,0 +1,292 @@
+#include "coro.hpp"
+
+#include "mempool.h"
+
+namespace co {
+
+namespace {
+
+static_assert(CORO_FRAME_SIZE % 8 == 0, "CORO_FRAME_SIZE must be a multiple of 8");
+
+alignas(8) uint8_t framePoolBuffer[CORO_FRAME_SIZE * CORO_FRAME_COUNT];
+MemPool_t framePool;
+
+/* main() 이전에 정적 생성자로 풀 초기화 */
+struct FramePoolInit {
+    FramePoolInit() {
+        MemPool_Init(&framePool, framePoolBuffer, CORO_FRAME_SIZE, CORO_FRAME_COUNT);
+    }
+} framePoolInit;
+
+}  // namespace
+
+namespace detail {
+
+void *allocFrame(std::size_t size) noexcept {
+    if (size > CORO_FRAME_SIZE) {
+        return nullptr;
+    }
+    return MemPool_Alloc(&framePool);
+}
+
+void freeFrame(void *frame) noexcept {
+    MemPool_Free(&framePool, frame);
+}
+
+void WaitList::push(Waiter *w) {
+    w->next = nullptr;
+    if (tail != nullptr) {
+        tail->next = w;
+    } else {
+        head = w;
+    }
+    tail = w;
+}
+
+Waiter *WaitList::pop() {
+    Waiter *w = head;
+
+    if (w != nullptr) {
+        head = w->next;
+        if (head == nullptr) {
+            tail = nullptr;
+        }
+        w->next = nullptr;
+    }
+    return w;
+}
+
+void WaitList::remove(Waiter *w) {
+    Waiter *prev = nullptr;
+
+    for (Waiter *it = head; it != nullptr; prev = it, it = it->next) {
+        if (it != w) {
+            continue;
+        }
+        if (prev != nullptr) {
+            prev->next = w->next;
+        } else {
+            head = w->next;
+        }
+        if (tail == w) {
+            tail = prev;
+        }
+        w->next = nullptr;
+        return;
+    }
+}
+
+Executor *wakeLocked(Waiter *w) {
+    Executor *executor = w->executor;
+
+    executor->disarmTimerLocked(w);
+    executor->makeReadyLocked(w);
+    return executor;
+}
+
+}  // namespace detail
+
+uint32_t freeFrames() noexcept {
+    return framePool.freeCount;
+}
+
+std::coroutine_handle<> Task::FinalAwaiter::await_suspend(Handle h) noexcept {
+    promise_type &promise = h.promise();
+
+    if (promise.continuation) {
+        return promise.continuation;
+    }
+    if (promise.detached) {
+        h.destroy();
+    }
+    return std::noop_coroutine();
+}
+
+Executor::Executor() {
+    Semaphore_Init(&wakeSem_, 0);
+}
+
+bool Executor::spawn(Task &&task) {
+    if (!task.valid()) {
+        return false;
+    }
+
+    Task::Handle h = task.release();
+    detail::Waiter &node = h.promise().node;
+
+    h.promise().detached = true;
+    node.executor = this;
+    node.handle = h;
+    {
+        detail::IrqLock lock;
+        makeReadyLocked(&node);
+    }
+    notify();
+    return true;
+}
+
+void Executor::run() {
+    for (;;) {
+        uint32_t timeout = poll();
+
+        if (timeout != 0) {
+            Semaphore_Wait(&wakeSem_, timeout);
+
+            // 타임아웃으로 깼으면 아직 세워져 있음. 타임아웃과 겹친 notify는 토큰 하나만 남김
+            detail::IrqLock lock;
+            waiting_ = false;
+        }
+    }
+}
+
+void Executor::taskEntry(void *params) {
+    static_cast<Executor *>(params)->run();
+}
+
+void Executor::makeReadyLocked(detail::Waiter *w) {
+    w->waitList = nullptr;
+    ready_.push(w);
+}
+
+void Executor::armTimerLocked(detail::Waiter *w, uint32_t ticks) {
+    detail::Waiter **link = &timers_;
+
+    w->wakeTick = Task_GetTickCount() + ticks;
+    w->timerArmed = true;
+    while (*link != nullptr && (int32_t)((*link)->wakeTick - w->wakeTick) <= 0) {
+        link = &(*link)->timerNext;
+    }
+    w->timerNext = *link;
+    *link = w;
+}
+
+void Executor::disarmTimerLocked(detail::Waiter *w) {
+    if (!w->timerArmed) {
+        return;
+    }
+    for (detail::Waiter **link = &timers_; *link != nullptr; link = &(*link)->timerNext) {
+        if (*link == w) {
+            *link = w->timerNext;
+            break;
+        }
+    }
+    w->timerNext = nullptr;
+    w->timerArmed = false;
+}
+
+void Executor::notify() {
+    bool wake;
+
+    {
+        detail::IrqLock lock;
+        wake = waiting_;
+        waiting_ = false;
+    }
+    // 실행 중인 run()은 poll 끝에서 ready_를 다시 보므로 신호가 필요 없음
+    if (wake) {
+        Semaphore_Signal(&wakeSem_);
+    }
+}
+
+uint32_t Executor::poll() {
+    uint32_t now = Task_GetTickCount();
+    detail::WaitList batch;
+
+    {
+        detail::IrqLock lock;
+
+        // 만료된 타이머: 대기 리스트에서 빼고 타임아웃으로 깨움
+        while (timers_ != nullptr && (int32_t)(timers_->wakeTick - now) <= 0) {
+            detail::Waiter *w = timers_;
+
+            timers_ = w->timerNext;
+            w->timerNext = nullptr;
+            w->timerArmed = false;
+            if (w->waitList != nullptr) {
+                w->waitList->remove(w);
+                w->timedOut = true;
+            }
+            makeReadyLocked(w);
+        }
+
+        // 이번 회차에 실행할 것만 떼어 냄 (실행 중 다시 ready 된 코루틴은 다음 회차)
+        batch = ready_;
+        ready_ = detail::WaitList{};
+    }
+
+    for (detail::Waiter *w = batch.pop(); w != nullptr; w = batch.pop()) {
+        w->handle.resume();
+    }
+
+    detail::IrqLock lock;
+
+    if (ready_.head != nullptr) {
+        return 0;
+    }
+    // 여기서부터 Semaphore_Wait까지 들어온 notify는 신호를 남겨 잠들지 않게 함
+    if (timers_ == nullptr) {
+        waiting_ = true;
+        return TASK_WAIT_FOREVER;
+    }
+
+    int32_t remaining = (int32_t)(timers_->wakeTick - Task_GetTickCount());
+    if (remaining <= 0) {
+        return 0;
+    }
+    waiting_ = true;
+    return (uint32_t)remaining;
+}
+
+void Semaphore::signal() noexcept {
+    Executor *woken = nullptr;
+
+    {
+        detail::IrqLock lock;
+        detail::Waiter *w = waiters_.pop();
+
+        if (w != nullptr) {
+            woken = detail::wakeLocked(w);
+        } else {
+            count_++;
+        }
+    }
+    if (woken != nullptr) {
+        woken->notify();
+    }
+}
+
+bool Semaphore::tryWait() noexcept {
+    detail::IrqLock lock;
+
+    if (count_ == 0) {
+        return false;
+    }
+    count_--;
+    return true;
+}
+
+bool Semaphore::WaitAwaiter::await_suspend(Task::Handle h) noexcept {
+    detail::Waiter &node = h.promise().node;
+    detail::IrqLock lock;
+
+    if (sem_.count_ > 0) {
+        sem_.count_--;
+        acquired_ = true;
+        return false;
+    }
+    if (timeout_ == 0) {
+        return false;
+    }
+
+    node.handle = h;
+    node.timedOut = false;
+    node.waitList = &sem_.waiters_;
+    sem_.waiters_.push(&node);
+    if (timeout_ != TASK_WAIT_FOREVER) {
+        node.executor->armTimerLocked(&node, timeout_);
+    }
+    node_ = &node;
+    return true;
+}
+
+}  // namespace co
@@ -0,0 +1,122 @@
+#include "governor.h"
+#include "scheduler.h"
+#include "task.h"
+
+static volatile uint32_t governorIdleTicks = 0;
+static volatile uint32_t governorLoad = 100;
+static volatile uint8_t governorPinCount[CLOCK_PROFILE_COUNT];
+static uint8_t governorLowWindows = 0;
+
+static TCB_t governorTaskTCB;
+static uint32_t governorTaskStack[128];
+
+/* SysTick 마다 호출 - 틱 시점에 idle 태스크가 돌고 있었는지 샘플링 */
+void Governor_TickHook(uint8_t idle, uint32_t ticks)
+{
+    if (idle) {
+        governorIdleTicks += ticks;
+    }
+}
+
+uint32_t Governor_GetLoad(void)
+{
+    return governorLoad;
+}
+
+/* 고정 요청 중 가장 높은 프로파일 */
+static ClockProfile_t Governor_GetFloor(void)
+{
+    for (int p = CLOCK_PROFILE_COUNT - 1; p > GOVERNOR_MIN_PROFILE; p--) {
+        if (governorPinCount[p] > 0) {
+            return (ClockProfile_t)p;
+        }
+    }
+    return GOVERNOR_MIN_PROFILE;
+}
+
+static ClockProfile_t Governor_SelectProfile(ClockProfile_t current, uint32_t load)
+{
+    ClockProfile_t target = current;
+
+    if (load >= GOVERNOR_UP_THRESHOLD) {
+        // 데드라인 위험 - 단계적으로 올리지 않고 바로 최대로
+        target = GOVERNOR_MAX_PROFILE;
+        governorLowWindows = 0;
+    } else if (load < GOVERNOR_DOWN_THRESHOLD && current > GOVERNOR_MIN_PROFILE) {
+        if (++governorLowWindows >= GOVERNOR_DOWN_WINDOWS) {
+            ClockProfile_t lower = (ClockProfile_t)(current - 1);
+            uint32_t projected = load * Clock_GetProfileConfig(current)->sysclkHz
+                                      / Clock_GetProfileConfig(lower)->sysclkHz;
+
+            // 내린 뒤 예상 부하가 상한을 넘으면 유지 (진동 방지)
+            if (projected < GOVERNOR_UP_THRESHOLD) {
+                target = lower;
+            }
+            governorLowWindows = 0;
+        }
+    } else {
+        governorLowWindows = 0;
+    }
+
+    return target;
+}
+
+static void Governor_TaskFunc(void *params)
+{
+    (void)params;
+
+    while (1) {
+        Task_Delay(GOVERNOR_WINDOW_TICKS);
+
+        __disable_irq();
+        uint32_t idle = governorIdleTicks;
+        governorIdleTicks = 0;
+        __enable_irq();
+
+        if (idle > GOVERNOR_WINDOW_TICKS) {
+            idle = GOVERNOR_WINDOW_TICKS;
+        }
+        governorLoad = 100U - (idle * 100U) / GOVERNOR_WINDOW_TICKS;
+
+        // 하한 확인과 전환 사이에 RequestMinProfile이 끼면 방금 올린 클럭을 다시 내림.
+        // Clock_SetProfile은 어차피 인터럽트를 끄고 전환하므로 판단까지 같은 구간에 묶음
+        __disable_irq();
+        ClockProfile_t current = Clock_GetProfile();
+        ClockProfile_t target = Governor_SelectProfile(current, governorLoad);
+        ClockProfile_t floor = Governor_GetFloor();
+
+        if (target < floor) {
+            target = floor;
+        }
+        if (target != current) {
+            Clock_SetProfile(target);
+        }
+        __enable_irq();
+    }
+}
+
+void Governor_RequestMinProfile(ClockProfile_t profile)
+{
+    // 비교와 전환 사이에 거버너 태스크가 클럭을 바꾸지 못하도록 한 구간에서
+    __disable_irq();
+    governorPinCount[profile]++;
+    if (Clock_GetProfile() < profile) {
+        Clock_SetProfile(profile);
+    }
+    __enable_irq();
+}
+
+void Governor_ReleaseMinProfile(ClockProfile_t profile)
+{
+    __disable_irq();
+    if (governorPinCount[profile] > 0) {
+        governorPinCount[profile]--;
+    }
+    __enable_irq();
+}
+
+void Governor_Init(void)
+{
+    Task_CreateStatic(&governorTaskTCB, governorTaskStack, sizeof(governorTaskStack),
+                      Governor_TaskFunc, "Governor", NULL, GOVERNOR_TASK_PRIORITY, 0);
+}
@@ -9,6 +9,8 @@
 #include "stm32f4xx.h"  // 또는 사용하는 MCU 헤더
 #include "scheduler.h"
 #include "task.h"
+#include "svc.h"
+#include <stddef.h>
 
 /*---------------------------------------------------------------------------
  * PendSV_Handler - 컨텍스트 스위칭 수행
@@ -34,6 +36,9 @@ __attribute__((naked)) void PendSV_Handler(void)
         "MRS     R2, PSP                \n"  // PSP 가져오기
         "STMDB   R2!, {R4-R11}          \n"  // R4-R11 저장 (스택에 push)
         "STR     R2, [R1]               \n"  // stackPointer 업데이트 (TCB 첫 필드)
+        "MRS     R3, CONTROL            \n"  // 시스템 콜 중이면 일시적으로 특권일 수 있음
+        "AND     R3, R3, #1             \n"
+        "STR     R3, [R1, %[controlOffset]] \n"
 
     "_load_next:                        \n"
         // === 다음 태스크로 전환 ===
@@ -41,6 +46,37 @@ __attribute__((naked)) void PendSV_Handler(void)
         "LDR     R1, =nextTask          \n"
         "LDR     R2, [R1]               \n"  // nextTask 로드
         "STR     R2, [R0]               \n"  // currentTask = nextTask
+#if TASK_NEWLIB_REENT
+        "ADDW    R3, R2, %[reentOffset] \n"  // _impure_ptr = &nextTask->reent
+        "LDR     R1, =_impure_ptr       \n"
+        "STR     R3, [R1]               \n"
+#endif
+
+        // CONTROL.nPRIV 복원
+        "LDR     R3, [R2, %[controlOffset]] \n"
+        "MRS     R1, CONTROL            \n"
+        "BIC     R1, R1, #1             \n"
+        "ORR     R1, R1, R3             \n"
+        "MSR     CONTROL, R1            \n"
+        "ISB                            \n"
+
+#if MPU_ENABLE
+        // 도메인이 없거나 이미 로드된 도메인이면 생략
+        "LDR     R3, [R2, %[mpuOffset]] \n"
+        "CBZ     R3, _mpu_done          \n"
+        "LDR     R1, =mpuActiveDomain   \n"
+        "LDR     R0, [R1]               \n"
+        "CMP     R0, R3                 \n"
+        "BEQ     _mpu_done              \n"
+        "STR     R3, [R1]               \n"
+        // RBAR(VALID|REGION)/RASR 4쌍을 RBAR~RASR_A3에 연속 저장 (R4-R11은 아직 복원 전)
+        "LDMIA   R3, {R4-R11}           \n"
+        "LDR     R0, =0xE000ED9C        \n"  // MPU->RBAR
+        "STMIA   R0, {R4-R11}           \n"
+        "DSB                            \n"
+        "ISB                            \n"
+    "_mpu_done:                         \n"
+#endif
 
         // === 다음 태스크 컨텍스트 복원 ===
         "LDR     R0, [R2]               \n"  // stackPointer 로드
@@ -53,6 +89,68 @@ __attribute__((naked)) void PendSV_Handler(void)
         // Thread mode + PSP 사용으로 복귀
         "LDR     LR, =0xFFFFFFFD        \n"
         "BX      LR                     \n"
+        :
+        : [controlOffset] "i" (offsetof(TCB_t, control))
+#if TASK_NEWLIB_REENT
+        , [reentOffset] "i" (offsetof(TCB_t, reent))
+#endif
+#if MPU_ENABLE
+        , [mpuOffset] "i" (offsetof(TCB_t, mpuDomain))
+#endif
+    );
+}
+
+/*---------------------------------------------------------------------------
+ * SVC_Handler - 시스템 콜 디스패치 (svc.h)
+ *
+ * 인자는 R0-R3 그대로 두고 스택 프레임의 복귀 주소만 바꿔서, 커널 함수가
+ * 예외 복귀 후 호출한 태스크의 스택 위에서 Thread mode로 실행되게 한다.
+ * 그래서 커널 함수 안에서 블록(Scheduler_Schedule)해도 그대로 동작한다.
+ *
+ *   특권 호출자:   PC = 커널 함수, LR = svc 다음 명령
+ *   비특권 호출자: CONTROL.nPRIV = 0, PC = Svc_Trampoline, R12 = svcUserTable의 검사 래퍼,
+ *                  LR = svc 다음 명령. 트램펄린이 함수 호출 후 nPRIV를 다시 세움
+ *---------------------------------------------------------------------------*/
+__attribute__((naked)) void SVC_Handler(void)
+{
+    __asm volatile (
+        "TST     LR, #4                 \n"  // 호출 시 사용하던 스택
+        "ITE     EQ                     \n"
+        "MRSEQ   R0, MSP                \n"
+        "MRSNE   R0, PSP                \n"
+        "LDR     R3, [R0, #24]          \n"  // 스택된 PC (svc 다음 명령)
+        "LDRB    R1, [R3, #-2]          \n"  // svc 명령의 즉치값
+        "CMP     R1, %[count]           \n"
+        "BHS     _svc_invalid           \n"
+        "ORR     R3, R3, #1             \n"
+        "STR     R3, [R0, #20]          \n"  // 스택된 LR = 복귀 주소 (Thumb)
+        "MRS     R12, CONTROL           \n"  // R12는 하드웨어가 스택에 저장해 둠
+        "TST     R12, #1                \n"
+        "BNE     _svc_unprivileged      \n"
+        "LDR     R2, =svcTable          \n"
+        "LDR     R2, [R2, R1, LSL #2]   \n"  // 커널 함수 주소
+        "BIC     R2, R2, #1             \n"
+        "STR     R2, [R0, #24]          \n"  // 스택된 PC = 커널 함수
+        "BX      LR                     \n"
+
+    "_svc_unprivileged:                 \n"
+        "LDR     R2, =svcUserTable      \n"
+        "LDR     R2, [R2, R1, LSL #2]   \n"  // 인자를 검사하는 래퍼
+        "BIC     R12, R12, #1           \n"
+        "MSR     CONTROL, R12           \n"  // 커널 함수가 도는 동안만 특권
+        "ISB                            \n"
+        "STR     R2, [R0, #16]          \n"  // 스택된 R12 = 래퍼
+        "LDR     R2, =Svc_Trampoline    \n"
+        "BIC     R2, R2, #1             \n"
+        "STR     R2, [R0, #24]          \n"  // 스택된 PC = 트램펄린
+        "BX      LR                     \n"
+
+    "_svc_invalid:                      \n"
+        "MOV     R1, #-1                \n"
+        "STR     R1, [R0]               \n"  // 스택된 R0 = -1
+        "BX      LR                     \n"
+        :
+        : [count] "i" (SVC_COUNT)
     );
 }
 
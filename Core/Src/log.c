@@ -0,0 +1,124 @@
+#include "log.h"
+#include "main.h"
+#include "console.h"
+#include "SEGGER_RTT.h"
+#include <stdio.h>
+
+#define LOG_SLOT_MASK       (LOG_SLOTS - 1U)
+#define LOG_LINE_MAX        128
+
+static LogSlot_t logSlots[LOG_SLOTS];
+static volatile uint32_t logHead = 0;   // 다음에 예약할 슬롯 (free-running)
+static volatile uint32_t logTail = 0;   // 다음에 내보낼 슬롯
+static volatile uint32_t logDropped = 0;
+
+#if LOG_BACKEND == LOG_BACKEND_RTT
+static NOINIT uint8_t logRttBuffer[LOG_SLOTS * sizeof(LogSlot_t)];
+#endif
+
+#if LOG_BACKEND == LOG_BACKEND_UART
+static const char *const logLevelTag[] = { "D", "I", "W", "E" };
+#endif
+
+void Log_Init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+#if LOG_BACKEND == LOG_BACKEND_RTT
+    SEGGER_RTT_ConfigUpBuffer(LOG_RTT_CHANNEL, "Log", logRttBuffer, sizeof(logRttBuffer),
+                              SEGGER_RTT_MODE_NO_BLOCK_SKIP);
+#endif
+}
+
+uint32_t Log_GetDropped(void)
+{
+    return logDropped;
+}
+
+/* 락 없이 슬롯 예약 (LDREX/STREX), 태스크/ISR 어디서든 호출 가능.
+ * meta 워드를 마지막에 써서 소비자가 미완성 슬롯을 읽지 않게 함 */
+void Log_Write(uint32_t meta, uint32_t a0, uint32_t a1, uint32_t a2,
+               uint32_t a3, uint32_t a4, uint32_t a5)
+{
+    uint32_t head;
+    LogSlot_t *slot;
+
+    do {
+        head = __LDREXW(&logHead);
+        if (head - logTail >= LOG_SLOTS) {
+            __CLREX();
+            logDropped++;
+            return;
+        }
+    } while (__STREXW(head + 1U, &logHead) != 0);
+
+    slot = &logSlots[head & LOG_SLOT_MASK];
+    slot->timestamp = DWT->CYCCNT;
+    slot->args[0] = a0;
+    slot->args[1] = a1;
+    slot->args[2] = a2;
+    slot->args[3] = a3;
+    slot->args[4] = a4;
+    slot->args[5] = a5;
+    __DMB();
+    slot->meta = meta | LOG_META_VALID;
+}
+
+#if LOG_BACKEND == LOG_BACKEND_UART
+static uint8_t Log_Emit(const LogSlot_t *slot)
+{
+    char line[LOG_LINE_MAX];
+    const char *fmt = &__log_fmt_start[slot->meta & 0xFFFFU];
+    int n;
+
+    n = snprintf(line, sizeof(line), "[%10lu] %s ", (unsigned long)slot->timestamp,
+                 logLevelTag[(slot->meta >> 20) & 0x3U]);
+    n += snprintf(&line[n], sizeof(line) - (uint32_t)n, fmt,
+                  slot->args[0], slot->args[1], slot->args[2],
+                  slot->args[3], slot->args[4], slot->args[5]);
+    if (n >= (int)sizeof(line) - 2) {
+        n = (int)sizeof(line) - 3;
+    }
+    line[n++] = '\r';
+    line[n++] = '\n';
+
+    // idle 태스크는 블록하면 안 되므로 한 줄이 통째로 들어갈 자리가 없으면 다음 기회에
+    return (Console_TryWrite(line, (uint32_t)n) != 0) ? 1 : 0;
+}
+#elif LOG_BACKEND == LOG_BACKEND_RTT
+static uint8_t Log_Emit(const LogSlot_t *slot)
+{
+    if (SEGGER_RTT_GetAvailWriteSpace(LOG_RTT_CHANNEL) < sizeof(LogSlot_t)) {
+        return 0;
+    }
+    // 채널 1의 writer는 idle 태스크뿐이라 RTT 락이 필요 없음
+    SEGGER_RTT_WriteNoLock(LOG_RTT_CHANNEL, slot, sizeof(LogSlot_t));
+    return 1;
+}
+#else
+static uint8_t Log_Emit(const LogSlot_t *slot)
+{
+    (void)slot;
+    return 0;
+}
+#endif
+
+void Log_Process(void)
+{
+    while (logTail != logHead) {
+        LogSlot_t *slot = &logSlots[logTail & LOG_SLOT_MASK];
+
+        // 예약만 되고 아직 기록 중인 슬롯
+        if ((slot->meta & LOG_META_VALID) == 0) {
+            break;
+        }
+        if (!Log_Emit(slot)) {
+            break;
+        }
+
+        slot->meta = 0;
+        __DMB();
+        logTail++;
+    }
+}
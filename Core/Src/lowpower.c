@@ -0,0 +1,192 @@
+#include "lowpower.h"
+#include "clock.h"
+#include "scheduler.h"
+#include "task.h"
+
+#define LOWPOWER_RTC_PREDIV_A       31U     // LSI 32kHz / 32 = 1kHz (SSR 1틱 = 약 1ms)
+#define LOWPOWER_RTC_PREDIV_S       999U
+#define LOWPOWER_CALIB_RTC_TICKS    16U
+#define LOWPOWER_MS_PER_DAY         86400000UL
+
+static volatile uint32_t lowPowerBudgetUs = LOWPOWER_WAKE_LATENCY_BUDGET_US;
+static uint32_t lowPowerLsiHz = 32000U;
+/* RTC 1ms(공칭) 당 실제 경과 시간, Q16 */
+static uint32_t lowPowerRtcScaleQ16 = 65536U;
+
+void LowPower_SetWakeLatencyBudget(uint32_t us)
+{
+    lowPowerBudgetUs = us;
+}
+
+static void LowPower_RtcUnlock(void)
+{
+    RTC->WPR = 0xCA;
+    RTC->WPR = 0x53;
+}
+
+static void LowPower_RtcLock(void)
+{
+    RTC->WPR = 0xFF;
+}
+
+/* 자정 기준 ms (RTC 공칭 단위) */
+static uint32_t LowPower_RtcReadMs(void)
+{
+    uint32_t ssr, tr;
+
+    // STOP 이후 섀도 레지스터가 갱신될 때까지 대기
+    RTC->ISR &= ~RTC_ISR_RSF;
+    while ((RTC->ISR & RTC_ISR_RSF) == 0);
+
+    ssr = RTC->SSR;
+    tr = RTC->TR;
+    (void)RTC->DR;  // 섀도 잠금 해제
+
+    uint32_t hours = ((tr >> 20) & 0x3U) * 10U + ((tr >> 16) & 0xFU);
+    uint32_t minutes = ((tr >> 12) & 0x7U) * 10U + ((tr >> 8) & 0xFU);
+    uint32_t seconds = ((tr >> 4) & 0x7U) * 10U + (tr & 0xFU);
+
+    return ((hours * 3600U + minutes * 60U + seconds) * 1000U)
+         + (LOWPOWER_RTC_PREDIV_S - ssr);
+}
+
+/* LSI는 17~47kHz로 편차가 커서 DWT 사이클로 한 번 보정 */
+static void LowPower_CalibrateLsi(void)
+{
+    uint32_t ssr, start, cycles, realUs;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    ssr = RTC->SSR;
+    while (RTC->SSR == ssr);
+    start = DWT->CYCCNT;
+
+    for (uint32_t i = 0; i < LOWPOWER_CALIB_RTC_TICKS; i++) {
+        ssr = RTC->SSR;
+        while (RTC->SSR == ssr);
+    }
+    cycles = DWT->CYCCNT - start;
+
+    realUs = cycles / (SystemCoreClock / 1000000U);
+    lowPowerRtcScaleQ16 = (uint32_t)(((uint64_t)realUs << 16) / (LOWPOWER_CALIB_RTC_TICKS * 1000U));
+    lowPowerLsiHz = (uint32_t)((uint64_t)LOWPOWER_CALIB_RTC_TICKS
+                               * (LOWPOWER_RTC_PREDIV_A + 1U) * 1000000U / realUs);
+}
+
+void LowPower_Init(void)
+{
+    __HAL_RCC_PWR_CLK_ENABLE();
+    PWR->CR |= PWR_CR_DBP;
+
+    RCC->CSR |= RCC_CSR_LSION;
+    while ((RCC->CSR & RCC_CSR_LSIRDY) == 0);
+
+    if ((RCC->BDCR & RCC_BDCR_RTCSEL) != RCC_BDCR_RTCSEL_1) {
+        // RTC 클럭 소스 변경은 백업 도메인 리셋 후에만 가능
+        RCC->BDCR |= RCC_BDCR_BDRST;
+        RCC->BDCR &= ~RCC_BDCR_BDRST;
+        RCC->BDCR |= RCC_BDCR_RTCSEL_1;
+    }
+    RCC->BDCR |= RCC_BDCR_RTCEN;
+
+    LowPower_RtcUnlock();
+    RTC->ISR |= RTC_ISR_INIT;
+    while ((RTC->ISR & RTC_ISR_INITF) == 0);
+    RTC->PRER = LOWPOWER_RTC_PREDIV_S;
+    RTC->PRER |= LOWPOWER_RTC_PREDIV_A << RTC_PRER_PREDIV_A_Pos;
+    RTC->ISR &= ~RTC_ISR_INIT;
+
+    // 웨이크업 타이머: RTC/16 클럭
+    RTC->CR &= ~RTC_CR_WUTE;
+    while ((RTC->ISR & RTC_ISR_WUTWF) == 0);
+    RTC->CR &= ~RTC_CR_WUCKSEL;
+    RTC->CR |= RTC_CR_WUTIE;
+    LowPower_RtcLock();
+
+    // 웨이크업 이벤트는 EXTI 22 상승 에지
+    EXTI->IMR |= EXTI_IMR_MR22;
+    EXTI->RTSR |= EXTI_RTSR_TR22;
+    NVIC_SetPriority(RTC_WKUP_IRQn, 0x0F);
+    NVIC_EnableIRQ(RTC_WKUP_IRQn);
+
+    LowPower_CalibrateLsi();
+}
+
+void RTC_WKUP_IRQHandler(void)
+{
+    RTC->ISR &= ~RTC_ISR_WUTF;
+    EXTI->PR = EXTI_PR_PR22;
+}
+
+static void LowPower_StartWakeupTimer(uint32_t sleepUs)
+{
+    uint32_t counts = (uint32_t)(((uint64_t)sleepUs * (lowPowerLsiHz / 16U)) / 1000000U);
+
+    if (counts == 0) counts = 1;
+    if (counts > 0x10000U) counts = 0x10000U;
+
+    LowPower_RtcUnlock();
+    RTC->CR &= ~RTC_CR_WUTE;
+    while ((RTC->ISR & RTC_ISR_WUTWF) == 0);
+    RTC->WUTR = counts - 1U;
+    RTC->ISR &= ~RTC_ISR_WUTF;
+    RTC->CR |= RTC_CR_WUTE;
+    LowPower_RtcLock();
+}
+
+static void LowPower_StopWakeupTimer(void)
+{
+    LowPower_RtcUnlock();
+    RTC->CR &= ~RTC_CR_WUTE;
+    RTC->ISR &= ~RTC_ISR_WUTF;
+    LowPower_RtcLock();
+    EXTI->PR = EXTI_PR_PR22;
+}
+
+static void LowPower_EnterStop(uint32_t sleepUs)
+{
+    uint32_t startMs, endMs, elapsedMs;
+
+    Clock_WaitUartIdle();
+
+    startMs = LowPower_RtcReadMs();
+    LowPower_StartWakeupTimer(sleepUs);
+
+    SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+    HAL_PWR_EnterSTOPMode(PWR_LOWPOWERREGULATOR_ON, PWR_STOPENTRY_WFI);
+
+    // HSI 16MHz로 깨어남 - 원래 프로파일(PLL) 복원. SysTick도 여기서 재시작됨
+    Clock_SetProfile(Clock_GetProfile());
+
+    LowPower_StopWakeupTimer();
+    endMs = LowPower_RtcReadMs();
+
+    elapsedMs = (endMs + LOWPOWER_MS_PER_DAY - startMs) % LOWPOWER_MS_PER_DAY;
+    elapsedMs = (uint32_t)(((uint64_t)elapsedMs * lowPowerRtcScaleQ16) >> 16);
+
+    Task_AdvanceTicks(elapsedMs * SYSTICK_FREQ_HZ / 1000U);
+}
+
+void LowPower_Idle(void)
+{
+    uint32_t ticks, sleepUs;
+
+    __disable_irq();
+
+    ticks = Task_GetTicksToNextWake();
+    sleepUs = (ticks >= LOWPOWER_MAX_SLEEP_MS * SYSTICK_FREQ_HZ / 1000U)
+              ? LOWPOWER_MAX_SLEEP_MS * 1000U
+              : ticks * (1000000U / SYSTICK_FREQ_HZ);
+
+    if (LOWPOWER_STOP_EXIT_US <= lowPowerBudgetUs
+        && sleepUs >= LOWPOWER_STOP_EXIT_US + LOWPOWER_STOP_MIN_SLEEP_US) {
+        // 탈출 비용만큼 일찍 깨어나 데드라인을 지킴
+        LowPower_EnterStop(sleepUs - LOWPOWER_STOP_EXIT_US);
+    } else {
+        // PRIMASK가 걸려 있어도 WFI는 대기 인터럽트로 깨어남
+        __WFI();
+    }
+
+    __enable_irq();
+}
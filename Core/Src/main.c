@@ -24,8 +24,13 @@
 #include <stdio.h>
 
 #include "SEGGER_RTT.h"
+#include "clock.h"
+#include "console.h"
+#include "uart_rx.h"
+#include "svc.h"
 #include "scheduler.h"
 #include "task.h"
+#include "boottime.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -45,27 +50,33 @@
 
 /* Private variables ---------------------------------------------------------*/
 UART_HandleTypeDef huart2;
+DMA_HandleTypeDef hdma_usart2_rx;
+DMA_HandleTypeDef hdma_usart2_tx;
 
 /* USER CODE BEGIN PV */
 // === 정적 메모리 할당 (Static Allocation) ===
 // 컴파일 타임에 메모리가 확보되므로 런타임 메모리 부족이나 단편화가 발생하지 않습니다.
 
+// TASK_DEFINE: TCB/스택을 컴파일 타임에 채워 .task_table에 등록 (Scheduler_Start가 연결)
+// TASK_DEFINE(TCB, 이름, 함수, 파라미터, 우선순위, 타임슬라이스, 스택워드)
+void Task1_Func(void *params);
+void Task2_Func(void *params);
+void Task3_Func(void *params);
+
 // Task 1 (High Priority)
-static TCB_t tcb_task1;
-static uint32_t stack_task1[TASK_STACK_SIZE];
+TASK_DEFINE(tcb_task1, "Task1", Task1_Func, NULL, 0, 10, TASK_STACK_SIZE);
 
 // Task 2 (Round Robin A)
-static TCB_t tcb_task2;
-static uint32_t stack_task2[TASK_STACK_SIZE];
+TASK_DEFINE(tcb_task2, "Task2", Task2_Func, NULL, 1, 10, TASK_STACK_SIZE);
 
 // Task 3 (Round Robin B)
-static TCB_t tcb_task3;
-static uint32_t stack_task3[TASK_STACK_SIZE];
+TASK_DEFINE(tcb_task3, "Task3", Task3_Func, NULL, 1, 10, TASK_STACK_SIZE);
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
 void SystemClock_Config(void);
 static void MX_GPIO_Init(void);
+static void MX_DMA_Init(void);
 static void MX_USART2_UART_Init(void);
 /* USER CODE BEGIN PFP */
 
@@ -73,28 +84,40 @@ static void MX_USART2_UART_Init(void);
 
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
-int __io_putchar(int ch)
+// 링 버퍼에 복사만 하고 리턴 - 실제 전송은 DMA (console.c)
+// 비특권 태스크는 인터럽트를 끌 수 없으므로 시스템 콜로.
+// MPU 도메인으로 격리된 태스크는 newlib까지 오지 못함 (Sys_ConsoleWrite 직접 호출, task.h)
+int _write(int file, char *ptr, int len)
 {
-  HAL_UART_Transmit(&huart2, (uint8_t *)&ch, 1, HAL_MAX_DELAY);
-  return ch;
+  if (Sys_IsUnprivileged()) {
+    return Sys_ConsoleWrite(ptr, (uint32_t)len);
+  }
+  return Console_Write(ptr, (uint32_t)len);
 }
 
-int _write(int file, char *ptr, int len)
+int __io_putchar(int ch)
 {
-  for (int i = 0; i < len; i++)
-  {
-    __io_putchar(*ptr++);
-  }
-  return len;
+  uint8_t c = (uint8_t)ch;
+  _write(1, (char *)&c, 1);
+  return ch;
 }
 
 void Task1_Func(void *params)
 {
+    // 지연 초기화: 가장 높은 우선순위라 다른 태스크보다 먼저 실행됨.
+    // 그 전에 나온 printf는 consoleUart가 없어 버려짐
+    MX_DMA_Init();
+    MX_USART2_UART_Init();
+
+    printf("Starting RTOS Test...\r\n");
+    BootTime_Report();
+
+    // 절대 시각 기준 100 틱 주기 (루프 실행 시간만큼 밀리지 않음)
+    uint32_t lastWake = Task_GetTickCount();
     while (1)
     {
         printf("[Task 1] High Prio - Woke up!\r\n");
-        // 100 틱 동안 Block (SysTick 핸들러가 카운트 증가시켜 깨워야 함)
-        Task_Delay(100);
+        Task_DelayUntil(&lastWake, 100);
     }
 }
 
@@ -139,39 +162,28 @@ int main(void)
   HAL_Init();
 
   /* USER CODE BEGIN Init */
-
+  BootTime_Mark(BOOT_PHASE_HAL_INIT);
   /* USER CODE END Init */
 
   /* Configure the system clock */
   SystemClock_Config();
 
   /* USER CODE BEGIN SysInit */
+  BootTime_Mark(BOOT_PHASE_CLOCK);
   /* USER CODE END SysInit */
 
   /* Initialize all configured peripherals */
   MX_GPIO_Init();
-  MX_USART2_UART_Init();
   /* USER CODE BEGIN 2 */
+  BootTime_Mark(BOOT_PHASE_PERIPHERALS);
 
-  printf("Starting RTOS Test...\r\n");
-
-    // 1. 태스크 생성
-    // Stack Size: 128 words (512 bytes), TimeSlice: 10 ticks
-
-  // Task 1: 우선순위 0 (최상위)
-    // Task_CreateStatic(&TCB, 스택배열, 스택사이즈(Byte), 함수, 이름, 파라미터, 우선순위, 타임슬라이스)
-  	Task_CreateStatic(&tcb_task1, stack_task1, sizeof(stack_task1),
-                      Task1_Func, "Task1", NULL, 0, 10);
-
-    // Task 2: 우선순위 1
-    Task_CreateStatic(&tcb_task2, stack_task2, sizeof(stack_task2),
-                      Task2_Func, "Task2", NULL, 1, 10);
-
-    // Task 3: 우선순위 1
-    Task_CreateStatic(&tcb_task3, stack_task3, sizeof(stack_task3),
-                      Task3_Func, "Task3", NULL, 1, 10);
-
-    printf("Starting Scheduler...\n");
+    // 1. 태스크는 위의 TASK_DEFINE으로 정적 정의됨 (런타임 생성 없음)
+#if SCHEDULER_FAIR
+    // Task2/Task3는 같은 우선순위: 라운드 로빈 대신 70/30으로 CPU 분배
+    Task_SetWeight(&tcb_task2, 70);
+    Task_SetWeight(&tcb_task3, 30);
+#endif
+    // DMA/USART2 초기화는 .ioc에서 호출 생성을 끄고 Task1에서 수행 (리셋 -> 첫 태스크 단축)
 
     // 2. 스케줄러 시작 (여기서 제어권이 OS로 넘어가며, 리턴되지 않음)
     Task_StartScheduler();
@@ -196,36 +208,10 @@ int main(void)
   */
 void SystemClock_Config(void)
 {
-  RCC_OscInitTypeDef RCC_OscInitStruct = {0};
-  RCC_ClkInitTypeDef RCC_ClkInitStruct = {0};
-
-  /** Configure the main internal regulator output voltage
-  */
-  __HAL_RCC_PWR_CLK_ENABLE();
-  __HAL_PWR_VOLTAGESCALING_CONFIG(PWR_REGULATOR_VOLTAGE_SCALE1);
-
-  /** Initializes the RCC Oscillators according to the specified parameters
-  * in the RCC_OscInitTypeDef structure.
+  /** HSI 16MHz -> PLL 168MHz (Scale 1, FLASH_LATENCY_5, ART on)
+  * 런타임 전환은 Clock_SetProfile() 사용 (clock.c)
   */
-  RCC_OscInitStruct.OscillatorType = RCC_OSCILLATORTYPE_HSI;
-  RCC_OscInitStruct.HSIState = RCC_HSI_ON;
-  RCC_OscInitStruct.HSICalibrationValue = RCC_HSICALIBRATION_DEFAULT;
-  RCC_OscInitStruct.PLL.PLLState = RCC_PLL_NONE;
-  if (HAL_RCC_OscConfig(&RCC_OscInitStruct) != HAL_OK)
-  {
-    Error_Handler();
-  }
-
-  /** Initializes the CPU, AHB and APB buses clocks
-  */
-  RCC_ClkInitStruct.ClockType = RCC_CLOCKTYPE_HCLK|RCC_CLOCKTYPE_SYSCLK
-                              |RCC_CLOCKTYPE_PCLK1|RCC_CLOCKTYPE_PCLK2;
-  RCC_ClkInitStruct.SYSCLKSource = RCC_SYSCLKSOURCE_HSI;
-  RCC_ClkInitStruct.AHBCLKDivider = RCC_SYSCLK_DIV1;
-  RCC_ClkInitStruct.APB1CLKDivider = RCC_HCLK_DIV1;
-  RCC_ClkInitStruct.APB2CLKDivider = RCC_HCLK_DIV1;
-
-  if (HAL_RCC_ClockConfig(&RCC_ClkInitStruct, FLASH_LATENCY_0) != HAL_OK)
+  if (Clock_SetProfile(CLOCK_PROFILE_DEFAULT) != HAL_OK)
   {
     Error_Handler();
   }
@@ -259,11 +245,33 @@ static void MX_USART2_UART_Init(void)
     Error_Handler();
   }
   /* USER CODE BEGIN USART2_Init 2 */
-
+  // 클럭 프로파일 전환 시 BRR 재계산
+  Clock_RegisterUart(&huart2);
+  Console_Init(&huart2);
+  UartRx_Init(&huart2);
   /* USER CODE END USART2_Init 2 */
 
 }
 
+/**
+  * Enable DMA controller clock
+  */
+static void MX_DMA_Init(void)
+{
+
+  /* DMA controller clock enable */
+  __HAL_RCC_DMA1_CLK_ENABLE();
+
+  /* DMA interrupt init */
+  /* DMA1_Stream5_IRQn interrupt configuration */
+  HAL_NVIC_SetPriority(DMA1_Stream5_IRQn, 5, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Stream5_IRQn);
+  /* DMA1_Stream6_IRQn interrupt configuration */
+  HAL_NVIC_SetPriority(DMA1_Stream6_IRQn, 5, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Stream6_IRQn);
+
+}
+
 /**
   * @brief GPIO Initialization Function
   * @param None
@@ -0,0 +1,49 @@
+#include "mempool.h"
+#include "main.h"
+
+void MemPool_Init(MemPool_t *pool, void *buffer, uint32_t blockSize, uint32_t blockCount)
+{
+    uint8_t *block = (uint8_t *)buffer;
+
+    blockSize = (blockSize + 3U) & ~3U;
+    if (blockSize < sizeof(void *)) {
+        blockSize = sizeof(void *);
+    }
+
+    pool->freeList = NULL;
+    pool->blockSize = blockSize;
+    pool->blockCount = blockCount;
+    pool->freeCount = blockCount;
+
+    for (uint32_t i = 0; i < blockCount; i++) {
+        *(void **)block = pool->freeList;
+        pool->freeList = block;
+        block += blockSize;
+    }
+}
+
+void *MemPool_Alloc(MemPool_t *pool)
+{
+    void *block;
+
+    __disable_irq();
+    block = pool->freeList;
+    if (block != NULL) {
+        pool->freeList = *(void **)block;
+        pool->freeCount--;
+    }
+    __enable_irq();
+
+    return block;
+}
+
+void MemPool_Free(MemPool_t *pool, void *block)
+{
+    if (block == NULL) return;
+
+    __disable_irq();
+    *(void **)block = pool->freeList;
+    pool->freeList = block;
+    pool->freeCount++;
+    __enable_irq();
+}
@@ -0,0 +1,94 @@
+#include "mpu.h"
+#include "scheduler.h"
+
+const MpuDomain_t *mpuActiveDomain = NULL;
+
+static volatile uint32_t mpuFaultCount = 0;
+// 마지막 폴트 (디버거 확인용)
+volatile uint32_t mpuFaultAddress = 0;
+TCB_t *volatile mpuFaultTask = NULL;
+
+void Mpu_InitDomain(MpuDomain_t *domain)
+{
+    for (uint32_t i = 0; i < MPU_DOMAIN_REGIONS; i++) {
+        domain->regions[i].RBAR = ARM_MPU_RBAR(MPU_TASK_REGION_FIRST + i, 0U);
+        domain->regions[i].RASR = 0U;
+    }
+}
+
+int Mpu_SetRegion(MpuDomain_t *domain, uint32_t index, const void *base,
+                  uint32_t size, MpuAccess_t access)
+{
+    uint32_t addr = (uint32_t)base;
+    uint32_t sizeField;
+    uint32_t rasr;
+
+    if (index >= MPU_DOMAIN_REGIONS || size < 32U || (size & (size - 1U)) != 0U
+        || (addr & (size - 1U)) != 0U) {
+        return -1;
+    }
+
+    // RASR.SIZE: 영역 크기 = 2^(SIZE+1)
+    sizeField = 31U - __CLZ(size) - 1U;
+
+    switch (access) {
+    case MPU_ACCESS_RO:
+        rasr = ARM_MPU_RASR(1U, ARM_MPU_AP_URO, 0U, 1U, 1U, 1U, 0U, sizeField);
+        break;
+    case MPU_ACCESS_DEVICE:
+        rasr = ARM_MPU_RASR_EX(1U, ARM_MPU_AP_FULL, ARM_MPU_ACCESS_DEVICE(1U), 0U, sizeField);
+        break;
+    case MPU_ACCESS_RW:
+    default:
+        rasr = ARM_MPU_RASR(1U, ARM_MPU_AP_FULL, 0U, 1U, 1U, 1U, 0U, sizeField);
+        break;
+    }
+
+    domain->regions[index].RBAR = ARM_MPU_RBAR(MPU_TASK_REGION_FIRST + index, addr);
+    domain->regions[index].RASR = rasr;
+    return 0;
+}
+
+void Mpu_Init(void)
+{
+    ARM_MPU_Disable();
+
+    for (uint32_t i = 0; i < 8U; i++) {
+        ARM_MPU_ClrRegion(i);
+    }
+
+    // Flash 1MB: 코드/상수. 비특권은 읽기+실행만 (특권은 Flash 프로그래밍을 위해 쓰기 허용)
+    ARM_MPU_SetRegion(ARM_MPU_RBAR(0U, FLASH_BASE),
+                      ARM_MPU_RASR(0U, ARM_MPU_AP_URO, 0U, 0U, 1U, 0U, 0U, ARM_MPU_REGION_SIZE_1MB));
+
+    mpuActiveDomain = NULL;
+
+    SCB->SHCSR |= SCB_SHCSR_MEMFAULTENA_Msk;
+    ARM_MPU_Enable(MPU_CTRL_PRIVDEFENA_Msk);
+}
+
+uint8_t Mpu_HandleFault(void)
+{
+    // 다른 예외 중이거나(RETTOBASE=0) 특권 코드에서 난 폴트는 복구하지 않음
+    if ((SCB->ICSR & SCB_ICSR_RETTOBASE_Msk) == 0U
+        || (__get_CONTROL() & CONTROL_nPRIV_Msk) == 0U
+        || currentTask == NULL) {
+        return 0;
+    }
+
+    if (SCB->CFSR & SCB_CFSR_MMARVALID_Msk) {
+        mpuFaultAddress = SCB->MMFAR;
+    }
+    mpuFaultTask = currentTask;
+    mpuFaultCount++;
+    SCB->CFSR = SCB_CFSR_MEMFAULTSR_Msk;
+
+    // 폴트 난 명령에서 멈춘 채로 정지 (Resume하면 같은 접근을 다시 시도)
+    Task_Suspend(currentTask);
+    return 1;
+}
+
+uint32_t Mpu_GetFaultCount(void)
+{
+    return mpuFaultCount;
+}
@@ -0,0 +1,100 @@
+#include "mutex.h"
+#include "scheduler.h"
+
+void Mutex_Init(Mutex_t *mutex)
+{
+    mutex->owner = NULL;
+    mutex->nesting = 0;
+    mutex->waitListHead = NULL;
+    mutex->magic = MUTEX_MAGIC;
+}
+
+int Mutex_Lock(Mutex_t *mutex, uint32_t timeout)
+{
+    int result;
+
+    if (currentTask == NULL) {
+        return 0;
+    }
+
+    __disable_irq();
+
+    if (mutex->owner == NULL) {
+        mutex->owner = currentTask;
+        mutex->nesting = 1;
+        __enable_irq();
+        return 0;
+    }
+
+    if (mutex->owner == currentTask) {
+        mutex->nesting++;
+        __enable_irq();
+        return 0;
+    }
+
+    if (timeout == 0) {
+        __enable_irq();
+        return -1;
+    }
+
+    // 우선순위 상속: 숫자가 작을수록 높은 우선순위
+    if (currentTask->priority < mutex->owner->priority) {
+        mutex->owner->priority = currentTask->priority;
+    }
+
+    Task_AddToWaitList(&mutex->waitListHead, currentTask, timeout);
+    __enable_irq();
+
+    Scheduler_Schedule();
+
+    // Unlock이 소유권을 직접 넘겨줬으면 waitResult == 0
+    __disable_irq();
+    result = currentTask->waitResult;
+    if (result != 0) {
+        Task_RemoveFromWaitList(&mutex->waitListHead, currentTask);
+    }
+    __enable_irq();
+
+    return result;
+}
+
+void Mutex_Unlock(Mutex_t *mutex)
+{
+    TCB_t *woken;
+    uint8_t wasBoosted;
+
+    if (currentTask == NULL) {
+        return;
+    }
+
+    __disable_irq();
+
+    if (mutex->owner != currentTask) {
+        __enable_irq();
+        return;
+    }
+
+    if (--mutex->nesting > 0) {
+        __enable_irq();
+        return;
+    }
+
+    // 상속받은 우선순위 반납 (여러 뮤텍스를 중첩해 잡은 경우에도 여기서 원래대로)
+    wasBoosted = (currentTask->priority != currentTask->basePriority);
+    currentTask->priority = currentTask->basePriority;
+
+    woken = Task_WakeFromWaitList(&mutex->waitListHead);
+    mutex->owner = woken;
+    mutex->nesting = (woken != NULL) ? 1U : 0U;
+
+    // 남은 대기자가 새 소유자보다 높으면 새 소유자가 이어서 상속
+    if (woken != NULL && mutex->waitListHead != NULL
+        && mutex->waitListHead->priority < woken->priority) {
+        woken->priority = mutex->waitListHead->priority;
+    }
+    __enable_irq();
+
+    if (woken != NULL || wasBoosted) {
+        Scheduler_Schedule();
+    }
+}
@@ -0,0 +1,99 @@
+#include "partition.h"
+#include "scheduler.h"
+#include "clock.h"
+
+#if PARTITION_ENABLE
+
+volatile uint8_t partitionActive = PARTITION_SYSTEM;
+
+static const PartitionWindow_t *partitionWindows = NULL;
+static uint32_t partitionWindowCount = 0;
+static uint32_t partitionWindowIndex = 0;
+static volatile uint32_t partitionSwitchCount = 0;
+static volatile uint32_t partitionSwitchStamp = 0;
+
+int Partition_SetSchedule(const PartitionWindow_t *windows, uint32_t count)
+{
+    if (windows == NULL || count == 0 || count > PARTITION_MAX_WINDOWS) {
+        return -1;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        if (windows[i].durationUs == 0) {
+            return -1;
+        }
+    }
+
+    partitionWindows = windows;
+    partitionWindowCount = count;
+    return 0;
+}
+
+static inline uint32_t Partition_NextIndex(uint32_t index)
+{
+    return (index + 1U < partitionWindowCount) ? index + 1U : 0U;
+}
+
+void Partition_ConfigureTimer(void)
+{
+    PARTITION_TIMER->PSC = Clock_GetApb1TimerHz() / 1000000U - 1U;
+}
+
+void Partition_Init(void)
+{
+    TIM_TypeDef *timer = PARTITION_TIMER;
+
+    if (partitionWindowCount == 0) {
+        return;
+    }
+
+    PARTITION_TIMER_CLK_ENABLE();
+    timer->CR1 = 0;
+    Partition_ConfigureTimer();
+
+    // 첫 창 길이를 UG로 바로 적용하고, 두 번째 창 길이는 프리로드에 넣어 둠
+    partitionWindowIndex = 0;
+    partitionActive = partitionWindows[0].partition;
+    timer->ARR = partitionWindows[0].durationUs - 1U;
+    timer->EGR = TIM_EGR_UG;
+    timer->SR = 0;
+    timer->CR1 = TIM_CR1_ARPE;
+    timer->ARR = partitionWindows[Partition_NextIndex(0)].durationUs - 1U;
+    timer->DIER = TIM_DIER_UIE;
+
+    NVIC_SetPriority(PARTITION_TIMER_IRQn, PARTITION_TIMER_NVIC_PRIORITY);
+    NVIC_EnableIRQ(PARTITION_TIMER_IRQn);
+    timer->CR1 |= TIM_CR1_CEN;
+}
+
+uint32_t Partition_GetSwitchCount(void)
+{
+    return partitionSwitchCount;
+}
+
+uint32_t Partition_GetSwitchStamp(void)
+{
+    return partitionSwitchStamp;
+}
+
+/* 창 경계: 하드웨어가 이미 새 창의 ARR로 재장전했으므로 그다음 창 길이만 프리로드 */
+void PARTITION_TIMER_IRQHandler(void)
+{
+    TIM_TypeDef *timer = PARTITION_TIMER;
+    uint32_t index;
+
+    partitionSwitchStamp = DWT->CYCCNT;
+    timer->SR = ~TIM_SR_UIF;
+
+    index = Partition_NextIndex(partitionWindowIndex);
+    partitionWindowIndex = index;
+    timer->ARR = partitionWindows[Partition_NextIndex(index)].durationUs - 1U;
+
+    // 같은 파티션이 이어지면 스케줄할 것이 없음
+    if (partitionActive != partitionWindows[index].partition) {
+        partitionActive = partitionWindows[index].partition;
+        partitionSwitchCount++;
+        Scheduler_Schedule();
+    }
+}
+
+#endif
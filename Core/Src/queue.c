@@ -0,0 +1,104 @@
+#include "queue.h"
+#include "scheduler.h"
+#include <string.h>
+
+void Queue_Init(Queue_t *queue, void *buffer, uint32_t itemSize, uint32_t capacity)
+{
+    queue->buffer = (uint8_t *)buffer;
+    queue->itemSize = itemSize;
+    queue->capacity = capacity;
+    queue->head = 0;
+    queue->tail = 0;
+    queue->count = 0;
+    queue->sendWaitList = NULL;
+    queue->recvWaitList = NULL;
+    queue->magic = QUEUE_MAGIC;
+}
+
+/* 공간/데이터가 생길 때까지 대기. 0: 깨어남, -1: 타임아웃
+ * 인터럽트 비활성 상태로 진입, 비활성 상태로 반환 */
+static int Queue_Block(TCB_t **waitList, uint32_t deadline, uint32_t timeout)
+{
+    uint32_t remain = timeout;
+    int result;
+
+    if (timeout != TASK_WAIT_FOREVER) {
+        remain = deadline - Task_GetTickCount();
+        if ((int32_t)remain <= 0) {
+            return -1;
+        }
+    }
+
+    Task_AddToWaitList(waitList, currentTask, remain);
+    __enable_irq();
+
+    Scheduler_Schedule();
+
+    __disable_irq();
+    result = currentTask->waitResult;
+    if (result != 0) {
+        Task_RemoveFromWaitList(waitList, currentTask);
+    }
+    return result;
+}
+
+int Queue_Send(Queue_t *queue, const void *item, uint32_t timeout)
+{
+    uint32_t deadline = Task_GetTickCount() + timeout;
+    TCB_t *woken;
+
+    __disable_irq();
+
+    while (queue->count >= queue->capacity) {
+        if (timeout == 0 || currentTask == NULL
+            || Queue_Block(&queue->sendWaitList, deadline, timeout) != 0) {
+            __enable_irq();
+            return -1;
+        }
+    }
+
+    memcpy(&queue->buffer[queue->tail * queue->itemSize], item, queue->itemSize);
+    queue->tail = (queue->tail + 1 == queue->capacity) ? 0 : queue->tail + 1;
+    queue->count++;
+
+    woken = Task_WakeFromWaitList(&queue->recvWaitList);
+    __enable_irq();
+
+    if (woken != NULL) {
+        Scheduler_Schedule();
+    }
+    return 0;
+}
+
+int Queue_Receive(Queue_t *queue, void *item, uint32_t timeout)
+{
+    uint32_t deadline = Task_GetTickCount() + timeout;
+    TCB_t *woken;
+
+    __disable_irq();
+
+    while (queue->count == 0) {
+        if (timeout == 0 || currentTask == NULL
+            || Queue_Block(&queue->recvWaitList, deadline, timeout) != 0) {
+            __enable_irq();
+            return -1;
+        }
+    }
+
+    memcpy(item, &queue->buffer[queue->head * queue->itemSize], queue->itemSize);
+    queue->head = (queue->head + 1 == queue->capacity) ? 0 : queue->head + 1;
+    queue->count--;
+
+    woken = Task_WakeFromWaitList(&queue->sendWaitList);
+    __enable_irq();
+
+    if (woken != NULL) {
+        Scheduler_Schedule();
+    }
+    return 0;
+}
+
+uint32_t Queue_Count(const Queue_t *queue)
+{
+    return queue->count;
+}
@@ -0,0 +1,92 @@
+#include "rtt_channel.h"
+#include "main.h"
+#include "scheduler.h"
+#include "mutex.h"
+#include "SEGGER_RTT.h"
+
+typedef struct {
+    uint8_t used;
+    RttChannelMode_t mode;
+    TCB_t *owner;               // EXCLUSIVE 채널의 writer, NULL이면 검사 안 함
+    Mutex_t lock;               // SHARED 채널용 (우선순위 상속)
+    volatile uint32_t dropped;
+} RttChannel_t;
+
+static RttChannel_t rttChannels[SEGGER_RTT_MAX_NUM_UP_BUFFERS];
+
+int RttChannel_Open(const char *name, void *buffer, uint32_t size, RttChannelMode_t mode)
+{
+    RttChannel_t *ch = NULL;
+    int index;
+
+    __disable_irq();
+    for (index = RTT_CHANNEL_FIRST_DYNAMIC; index < SEGGER_RTT_MAX_NUM_UP_BUFFERS; index++) {
+        if (!rttChannels[index].used) {
+            ch = &rttChannels[index];
+            ch->used = 1;
+            break;
+        }
+    }
+    __enable_irq();
+
+    if (ch == NULL) {
+        return -1;
+    }
+
+    ch->mode = mode;
+    ch->owner = (mode == RTT_CHANNEL_EXCLUSIVE && __get_IPSR() == 0) ? currentTask : NULL;
+    ch->dropped = 0;
+    Mutex_Init(&ch->lock);
+
+    SEGGER_RTT_ConfigUpBuffer((unsigned)index, name, buffer, size, SEGGER_RTT_MODE_NO_BLOCK_SKIP);
+    return index;
+}
+
+/* 범위 밖이거나 열리지 않은 채널이면 NULL */
+static RttChannel_t *RttChannel_Get(int channel)
+{
+    if (channel < RTT_CHANNEL_FIRST_DYNAMIC || channel >= SEGGER_RTT_MAX_NUM_UP_BUFFERS
+        || !rttChannels[channel].used) {
+        return NULL;
+    }
+    return &rttChannels[channel];
+}
+
+int RttChannel_Write(int channel, const void *data, uint32_t len)
+{
+    RttChannel_t *ch = RttChannel_Get(channel);
+    unsigned written;
+
+    if (ch == NULL) {
+        return -1;
+    }
+
+    if (ch->mode == RTT_CHANNEL_EXCLUSIVE) {
+        if (ch->owner != NULL && (__get_IPSR() != 0 || ch->owner != currentTask)) {
+            return -1;
+        }
+        // 이 버퍼의 writer는 하나뿐이고 호스트는 RdOff만 건드리므로 락이 필요 없음
+        written = SEGGER_RTT_WriteNoLock((unsigned)channel, data, len);
+    } else {
+        // ISR은 태스크가 잡고 있는 뮤텍스를 기다릴 수 없음
+        if (__get_IPSR() != 0) {
+            ch->dropped += len;
+            return 0;
+        }
+        Mutex_Lock(&ch->lock, TASK_WAIT_FOREVER);
+        written = SEGGER_RTT_WriteNoLock((unsigned)channel, data, len);
+        Mutex_Unlock(&ch->lock);
+    }
+
+    if (written < len) {
+        ch->dropped += len - written;
+    }
+    return (int)written;
+}
+
+uint32_t RttChannel_GetDropped(int channel)
+{
+    RttChannel_t *ch = RttChannel_Get(channel);
+
+    return (ch != NULL) ? ch->dropped : 0;
+}
@@ -1,4 +1,12 @@
 #include "scheduler.h"
+#include "governor.h"
+#include "lowpower.h"
+#include "log.h"
+#include "mpu.h"
+#include "sst.h"
+#include "boottime.h"
+#include "partition.h"
+#include "clock.h"
 
 /* 전역 변수 정의 - 여기서 실제 메모리 할당 */
 TCB_t *currentTask = NULL;
@@ -7,18 +15,75 @@ TCB_t *taskListHead = NULL;
 
 static TCB_t *lastScheduled[MAX_PRIORITY_LEVELS] = {NULL};
 
-static TCB_t idleTaskTCB;
-static uint32_t idleTaskStack[64];
-static uint8_t idleTaskCreated = 0;
+#if SCHEDULER_EDF || SCHEDULER_FAIR
+/* 한 우선순위 레벨의 레디(READY/RUNNING) 태스크 최소 힙. 루트가 그 레벨에서 다음에 실행할 태스크 */
+typedef struct {
+    TCB_t **items;
+    uint32_t count;
+    uint32_t capacity;
+    uint8_t (*before)(const TCB_t *a, const TCB_t *b);
+} ReadyHeap_t;
+#endif
+
+#if SCHEDULER_EDF
+/* 절대 데드라인 비교 (틱 카운터 랩어라운드 고려) */
+static uint8_t Edf_Before(const TCB_t *a, const TCB_t *b)
+{
+    return (int32_t)((a->releaseTick + a->deadline) - (b->releaseTick + b->deadline)) < 0;
+}
+
+static TCB_t *edfItems[SCHEDULER_EDF_MAX_TASKS];
+static ReadyHeap_t edfHeap = { edfItems, 0, SCHEDULER_EDF_MAX_TASKS, Edf_Before };
+#endif
+
+#if SCHEDULER_FAIR
+static uint8_t Fair_Before(const TCB_t *a, const TCB_t *b)
+{
+    return (int32_t)(a->vruntime - b->vruntime) < 0;
+}
+
+static TCB_t *fairItems[SCHEDULER_FAIR_MAX_TASKS];
+static ReadyHeap_t fairHeap = { fairItems, 0, SCHEDULER_FAIR_MAX_TASKS, Fair_Before };
+/* 레디 태스크 vruntime의 하한. 오래 블록됐던 태스크가 밀린 만큼 독점하지 않도록 */
+static uint32_t fairMinVruntime = 0;
+#endif
+
+/* UART 로그 백엔드는 idle 태스크에서 snprintf를 돌리므로 스택이 더 필요 */
+#if LOG_BACKEND == LOG_BACKEND_UART
+#define IDLE_TASK_STACK_WORDS   256
+#else
+#define IDLE_TASK_STACK_WORDS   64
+#endif
+
+/* TASK_DEFINE 테이블 (링커 스크립트 .task_table) */
+extern TCB_t *const __task_table_start[];
+extern TCB_t *const __task_table_end[];
+
+static uint8_t taskTableLinked = 0;
+
+static void IdleTask_Func(void *params);
+
+TASK_DEFINE(idleTaskTCB, "Idle", IdleTask_Func, NULL, MAX_PRIORITY_LEVELS - 1, 1,
+            IDLE_TASK_STACK_WORDS);
 
 static void IdleTask_Func(void *params)
 {
     (void)params;
     while (1) {
+        Log_Process();
+#if LOWPOWER_STOP_ENABLE
+        LowPower_Idle();
+#else
         __WFI();
+#endif
     }
 }
 
+uint8_t Scheduler_IsIdleTask(const TCB_t *tcb)
+{
+    return tcb == &idleTaskTCB;
+}
+
 void Scheduler_Init(void)
 {
     currentTask = NULL;
@@ -35,19 +100,384 @@ void Scheduler_AddTask(TCB_t *tcb)
     __disable_irq();
     tcb->next = taskListHead;
     taskListHead = tcb;
+    Scheduler_TaskReady(tcb);
     __enable_irq();
 }
 
+#if SCHEDULER_EDF || SCHEDULER_FAIR
+static inline void ReadyHeap_Place(ReadyHeap_t *heap, uint32_t index, TCB_t *tcb)
+{
+    heap->items[index] = tcb;
+    tcb->heapSlot = (uint8_t)(index + 1);
+}
+
+static void ReadyHeap_SiftUp(ReadyHeap_t *heap, uint32_t index)
+{
+    TCB_t *tcb = heap->items[index];
+
+    while (index > 0) {
+        uint32_t parent = (index - 1) / 2;
+        if (!heap->before(tcb, heap->items[parent])) {
+            break;
+        }
+        ReadyHeap_Place(heap, index, heap->items[parent]);
+        index = parent;
+    }
+    ReadyHeap_Place(heap, index, tcb);
+}
+
+static void ReadyHeap_SiftDown(ReadyHeap_t *heap, uint32_t index)
+{
+    TCB_t *tcb = heap->items[index];
+
+    while (1) {
+        uint32_t child = 2 * index + 1;
+        if (child >= heap->count) {
+            break;
+        }
+        if (child + 1 < heap->count && heap->before(heap->items[child + 1], heap->items[child])) {
+            child++;
+        }
+        if (!heap->before(heap->items[child], tcb)) {
+            break;
+        }
+        ReadyHeap_Place(heap, index, heap->items[child]);
+        index = child;
+    }
+    ReadyHeap_Place(heap, index, tcb);
+}
+
+static ReadyHeap_t *Scheduler_HeapForLevel(uint8_t priority)
+{
+#if SCHEDULER_EDF
+    if (priority == SCHEDULER_EDF_PRIORITY) {
+        return &edfHeap;
+    }
+#endif
+#if SCHEDULER_FAIR
+    if (priority == SCHEDULER_FAIR_PRIORITY) {
+        return &fairHeap;
+    }
+#endif
+    return NULL;
+}
+
+/* 새로 넣을 힙. 상속으로 올라간 priority가 아니라 basePriority 기준이고,
+ * 예산 소진으로 강등된 태스크는 어느 힙에도 넣지 않음 */
+static ReadyHeap_t *Scheduler_HeapFor(const TCB_t *tcb)
+{
+    ReadyHeap_t *heap = Scheduler_HeapForLevel(tcb->basePriority);
+
+    if (tcb->priority > tcb->basePriority) {
+        return NULL;
+    }
+
+#if SCHEDULER_EDF
+    // EDF 레벨에서는 주기가 설정된 태스크만
+    if (heap == &edfHeap && tcb->period == 0) {
+        return NULL;
+    }
+#endif
+    return heap;
+}
+
+void Scheduler_ReadyHeapInsert(TCB_t *tcb)
+{
+    ReadyHeap_t *heap;
+
+    if (tcb->heapSlot != 0) {
+        return;
+    }
+    // 힙이 가득 차면 넣지 않음: 해당 태스크는 같은 레벨의 라운드 로빈으로 돈다
+    heap = Scheduler_HeapFor(tcb);
+    if (heap == NULL || heap->count >= heap->capacity) {
+        return;
+    }
+#if SCHEDULER_FAIR
+    if (heap == &fairHeap && (int32_t)(tcb->vruntime - fairMinVruntime) < 0) {
+        tcb->vruntime = fairMinVruntime;
+    }
+#endif
+    heap->items[heap->count] = tcb;
+    heap->count++;
+    ReadyHeap_SiftUp(heap, heap->count - 1);
+}
+
+void Scheduler_ReadyHeapRemove(TCB_t *tcb)
+{
+    ReadyHeap_t *heap;
+    uint32_t index;
+    TCB_t *last;
+
+    if (tcb->heapSlot == 0) {
+        return;
+    }
+    heap = Scheduler_HeapForLevel(tcb->basePriority);
+    index = tcb->heapSlot - 1U;
+    tcb->heapSlot = 0;
+    heap->count--;
+    if (index == heap->count) {
+        return;
+    }
+
+    // 마지막 원소로 빈자리를 메우고 위/아래 중 필요한 쪽으로 이동
+    last = heap->items[heap->count];
+    ReadyHeap_Place(heap, index, last);
+    ReadyHeap_SiftUp(heap, index);
+    ReadyHeap_SiftDown(heap, last->heapSlot - 1U);
+}
+#endif
+
+#if SCHEDULER_FAIR
+/* 실행 사이클을 가중치로 환산해 vruntime에 더함 */
+static void Scheduler_FairCharge(TCB_t *tcb, uint32_t cycles)
+{
+    uint32_t inv = (tcb->fairInvWeight != 0) ? tcb->fairInvWeight : (1UL << 16);
+
+    if (tcb->basePriority != SCHEDULER_FAIR_PRIORITY) {
+        return;
+    }
+    tcb->vruntime += (uint32_t)(((uint64_t)cycles * inv) >> 16);
+    if (tcb->heapSlot != 0) {
+        ReadyHeap_SiftDown(&fairHeap, tcb->heapSlot - 1U);
+    }
+    if (fairHeap.count > 0 && (int32_t)(fairHeap.items[0]->vruntime - fairMinVruntime) > 0) {
+        fairMinVruntime = fairHeap.items[0]->vruntime;
+    }
+}
+#endif
+
+#if SCHEDULER_BUDGET
+static void Scheduler_BudgetCharge(TCB_t *tcb, uint32_t cycles)
+{
+    if (tcb->budgetCycles == 0) {
+        return;
+    }
+    if (!tcb->budgetExhausted) {
+        if (cycles < tcb->budgetRemain) {
+            tcb->budgetRemain -= cycles;
+            return;
+        }
+        tcb->budgetRemain = 0;
+        tcb->budgetExhausted = 1;
+        tcb->budgetExhaustions++;
+    }
+
+    // 소진 조치. 강등 중에 뮤텍스를 놓으면 Mutex_Unlock이 basePriority로 되돌리므로 다시 적용
+    if (tcb->budgetAction == TASK_BUDGET_SUSPEND) {
+        // 블록 중이면 대기 리스트에 그대로 두고, 깨어날 때 Scheduler_TaskReady가 보류
+        if (tcb->state == TASK_STATE_READY || tcb->state == TASK_STATE_RUNNING) {
+            Scheduler_TaskUnready(tcb);
+            tcb->state = TASK_STATE_SUSPENDED;
+        }
+    } else if (tcb->priority == tcb->basePriority) {
+        // 뮤텍스 상속으로 올라가 있으면 강등하지 않음 (소유한 뮤텍스를 빨리 놓도록)
+        Scheduler_TaskUnready(tcb);
+        tcb->priority = SCHEDULER_BUDGET_DEMOTE_PRIORITY;
+    }
+}
+
+uint8_t Scheduler_BudgetRestore(TCB_t *tcb)
+{
+    if (!tcb->budgetExhausted) {
+        return 0;
+    }
+    tcb->budgetExhausted = 0;
+
+    if (tcb->priority > tcb->basePriority) {
+        tcb->priority = tcb->basePriority;
+    }
+    // Task_Suspend로도 정지된 태스크는 Task_Resume만 재개
+    if (tcb->state == TASK_STATE_SUSPENDED && tcb->budgetAction == TASK_BUDGET_SUSPEND
+        && !tcb->userSuspended) {
+        tcb->state = TASK_STATE_READY;
+    }
+    if (tcb->state == TASK_STATE_READY || tcb->state == TASK_STATE_RUNNING) {
+        Scheduler_TaskReady(tcb);
+        return 1;
+    }
+    return 0;
+}
+
+uint8_t Scheduler_BudgetReplenish(TCB_t *tcb, uint32_t now)
+{
+    if (tcb->budgetCycles == 0 || (int32_t)(now - tcb->budgetReplenishTick) < 0) {
+        return 0;
+    }
+    tcb->budgetReplenishTick = now + tcb->budgetPeriod;
+    tcb->budgetRemain = tcb->budgetCycles;
+    return Scheduler_BudgetRestore(tcb);
+}
+
+/* 클럭 변경 후: us로 정한 예산을 새 SystemCoreClock 사이클로 다시 환산 (남은 양은 비율대로) */
+static void Scheduler_BudgetRescale(void)
+{
+    uint32_t perUs = SystemCoreClock / 1000000U;
+
+    // 지금까지 돈 사이클은 바뀌기 전 비율로 청구
+    if (currentTask != NULL) {
+        Scheduler_ChargeRunning(currentTask);
+    }
+
+    for (TCB_t *task = taskListHead; task != NULL; task = task->next) {
+        uint32_t oldPerUs;
+
+        if (task->budgetCycles == 0) {
+            continue;
+        }
+        oldPerUs = task->budgetCycles / task->budgetUs;
+        if (oldPerUs == perUs) {
+            continue;
+        }
+        task->budgetRemain = (uint32_t)((uint64_t)task->budgetRemain * perUs / oldPerUs);
+        task->budgetCycles = task->budgetUs * perUs;
+    }
+}
+#endif
+
+#if SCHEDULER_SLICE_CYCLES
+/* SystemCoreClock 기준, Scheduler_ConfigureTick에서 갱신 */
+static uint32_t sliceCyclesPerTick;
+static uint32_t sliceTimerScaleQ16;     // 타이머 카운트 / CPU 사이클, Q16
+
+static inline uint32_t Scheduler_SliceCycles(const TCB_t *tcb)
+{
+    return tcb->timeSlice * sliceCyclesPerTick;
+}
+
+void Scheduler_ExpireSlice(TCB_t *tcb)
+{
+    tcb->sliceUsedCycles = Scheduler_SliceCycles(tcb);
+}
+
+static inline uint8_t Scheduler_SliceExpired(const TCB_t *tcb)
+{
+    return tcb->sliceUsedCycles >= Scheduler_SliceCycles(tcb);
+}
+
+/* 새로 실행할 태스크의 남은 슬라이스만큼 원샷 타이머 설정 (인터럽트 비활성 상태) */
+static void Scheduler_ArmSlice(TCB_t *tcb)
+{
+    TIM_TypeDef *timer = SCHEDULER_SLICE_TIMER;
+    uint32_t count;
+
+    timer->CR1 = TIM_CR1_OPM;
+    timer->SR = 0;
+    // idle은 교대할 필요가 없고, 깨워 봐야 전력만 씀
+    if (tcb->timeSlice == 0 || Scheduler_IsIdleTask(tcb)) {
+        return;
+    }
+    if (Scheduler_SliceExpired(tcb)) {
+        tcb->sliceUsedCycles = 0;
+    }
+
+    count = (uint32_t)(((uint64_t)(Scheduler_SliceCycles(tcb) - tcb->sliceUsedCycles)
+                        * sliceTimerScaleQ16) >> 16);
+    timer->CNT = 0;
+    timer->ARR = (count > 1U) ? count : 1U;
+    timer->CR1 = TIM_CR1_OPM | TIM_CR1_CEN;
+}
+
+static void Scheduler_ConfigureSliceTimer(void)
+{
+    TIM_TypeDef *timer = SCHEDULER_SLICE_TIMER;
+
+    sliceCyclesPerTick = SystemCoreClock / SYSTICK_FREQ_HZ;
+    sliceTimerScaleQ16 = (uint32_t)(((uint64_t)Clock_GetApb1TimerHz() << 16) / SystemCoreClock);
+
+    SCHEDULER_SLICE_TIMER_CLK_ENABLE();
+    timer->PSC = 0;
+    timer->DIER = TIM_DIER_UIE;
+    NVIC_SetPriority(SCHEDULER_SLICE_TIMER_IRQn, 0xFE);
+    NVIC_EnableIRQ(SCHEDULER_SLICE_TIMER_IRQn);
+}
+
+void SCHEDULER_SLICE_TIMER_IRQHandler(void)
+{
+    // 다시 설정하기 직전에 걸려 있던 만료면 SR이 이미 지워져 있음
+    if ((SCHEDULER_SLICE_TIMER->SR & TIM_SR_UIF) == 0) {
+        return;
+    }
+    SCHEDULER_SLICE_TIMER->SR = 0;
+
+    if (currentTask != NULL) {
+        __disable_irq();
+        Scheduler_ExpireSlice(currentTask);
+        __enable_irq();
+        Scheduler_Schedule();
+    }
+}
+#endif
+
+#if TASK_CYCLE_ACCOUNTING
+void Scheduler_ChargeRunning(TCB_t *tcb)
+{
+    uint32_t now = DWT->CYCCNT;
+    uint32_t cycles = now - tcb->runStartCycles;
+
+    tcb->runStartCycles = now;
+#if SCHEDULER_FAIR
+    Scheduler_FairCharge(tcb, cycles);
+#endif
+#if SCHEDULER_BUDGET
+    Scheduler_BudgetCharge(tcb, cycles);
+#endif
+#if SCHEDULER_SLICE_CYCLES
+    if (tcb->timeSlice != 0 && !Scheduler_SliceExpired(tcb)) {
+        tcb->sliceUsedCycles += cycles;
+    }
+#endif
+}
+#endif
+
+/* 실행 후보: READY/RUNNING이고 (시간 분할 시) 현재 창의 파티션 */
+static inline uint8_t Scheduler_IsRunnable(const TCB_t *task)
+{
+    if (task->state != TASK_STATE_READY && task->state != TASK_STATE_RUNNING) {
+        return 0;
+    }
+#if PARTITION_ENABLE
+    return Partition_IsActive(task->partition);
+#else
+    return 1;
+#endif
+}
+
+/* 선점 임계값을 쥔 태스크(디스패치된 뒤 아직 블록/양보하지 않음)는 선점돼 READY로 있어도
+ * 임계값 레벨에서 경쟁. 상속으로 priority가 임계값보다 올라가 있으면 priority 기준 */
+static inline uint8_t Scheduler_HoldsThreshold(const TCB_t *task)
+{
+#if SCHEDULER_BUDGET
+    // 예산 소진 조치 중에는 임계값으로 강등/정지를 무르지 않음
+    if (task->budgetExhausted) {
+        return 0;
+    }
+#endif
+    return task->thresholdHeld && task->preemptThreshold < task->priority;
+}
+
+static inline uint8_t Scheduler_EffectivePriority(const TCB_t *task)
+{
+    return Scheduler_HoldsThreshold(task) ? task->preemptThreshold : task->priority;
+}
+
 TCB_t *Scheduler_GetHighestPriorityTask(void)
 {
     TCB_t *task;
+    TCB_t *holder = NULL;
     uint8_t highestPriority = 255;
 
     task = taskListHead;
     while (task != NULL) {
-        if ((task->state == TASK_STATE_READY || task->state == TASK_STATE_RUNNING)) {
-            if (task->priority < highestPriority) {
-                highestPriority = task->priority;
+        if (Scheduler_IsRunnable(task)) {
+            uint8_t priority = Scheduler_EffectivePriority(task);
+
+            if (priority < highestPriority) {
+                highestPriority = priority;
+                holder = NULL;
+            }
+            if (priority == highestPriority && Scheduler_HoldsThreshold(task)) {
+                holder = task;
             }
         }
         task = task->next;
@@ -57,14 +487,34 @@ TCB_t *Scheduler_GetHighestPriorityTask(void)
         return NULL;
     }
 
+    // 임계값을 쥔 태스크는 레벨당 최대 하나 (임계값보다 높은 태스크만 그것을 선점하므로).
+    // 같은 레벨의 다른 태스크에게 자리를 내주지 않고 잡을 이어서 실행
+    if (holder != NULL) {
+        return holder;
+    }
+
+#if SCHEDULER_SLICE_CYCLES
+    // 슬라이스가 남은 실행 중 태스크는 같은 우선순위끼리 교대하지 않음 (만료 타이머가 교대)
+    if (currentTask != NULL && currentTask->state == TASK_STATE_RUNNING
+        && Scheduler_IsRunnable(currentTask) && currentTask->priority == highestPriority
+        && currentTask->timeSlice != 0 && !Scheduler_SliceExpired(currentTask)) {
+        return currentTask;
+    }
+#endif
+
     TCB_t *firstCandidate = NULL;
     TCB_t *afterLast = NULL;
     uint8_t foundLast = 0;
 
     task = taskListHead;
     while (task != NULL) {
-        if ((task->state == TASK_STATE_READY || task->state == TASK_STATE_RUNNING)
-            && task->priority == highestPriority) {
+        if (Scheduler_IsRunnable(task)
+            && task->priority == highestPriority
+#if SCHEDULER_EDF || SCHEDULER_FAIR
+            // 이 레벨 힙에 있는 태스크는 아래에서 힙 순서로
+            && !(task->heapSlot != 0 && task->basePriority == highestPriority)
+#endif
+            ) {
 
             if (firstCandidate == NULL) {
                 firstCandidate = task;
@@ -83,6 +533,15 @@ TCB_t *Scheduler_GetHighestPriorityTask(void)
 
     TCB_t *selected = (afterLast != NULL) ? afterLast : firstCandidate;
 
+#if SCHEDULER_EDF || SCHEDULER_FAIR
+    if (selected == NULL) {
+        ReadyHeap_t *heap = Scheduler_HeapForLevel(highestPriority);
+        if (heap != NULL && heap->count > 0) {
+            return heap->items[0];
+        }
+    }
+#endif
+
     if (selected != NULL) {
         lastScheduled[highestPriority] = selected;
     }
@@ -92,8 +551,17 @@ TCB_t *Scheduler_GetHighestPriorityTask(void)
 
 void Scheduler_Schedule(void)
 {
+    // 스케줄러 시작 전에는 PendSV를 걸면 안 됨
+    if (currentTask == NULL) {
+        return;
+    }
+
     __disable_irq();
 
+#if TASK_CYCLE_ACCOUNTING
+    Scheduler_ChargeRunning(currentTask);
+#endif
+
     TCB_t *next = Scheduler_GetHighestPriorityTask();
 
     if (next == NULL) {
@@ -107,6 +575,13 @@ void Scheduler_Schedule(void)
 
     nextTask = next;
     nextTask->state = TASK_STATE_RUNNING;
+    nextTask->thresholdHeld = 1;
+#if TASK_CYCLE_ACCOUNTING
+    nextTask->runStartCycles = DWT->CYCCNT;
+#endif
+#if SCHEDULER_SLICE_CYCLES
+    Scheduler_ArmSlice(nextTask);
+#endif
 
     __enable_irq();
 
@@ -122,17 +597,60 @@ void Scheduler_ContextSwitch(void)
     __ISB();
 }
 
+/* SystemCoreClock 기준으로 커널 틱 재설정 (클럭 변경 후에도 호출) */
+void Scheduler_ConfigureTick(void)
+{
+    SysTick_Config(SystemCoreClock / SYSTICK_FREQ_HZ);
+    NVIC_SetPriority(SysTick_IRQn, 0xFE);
+#if SCHEDULER_SLICE_CYCLES
+    Scheduler_ConfigureSliceTimer();
+#endif
+#if SCHEDULER_BUDGET
+    Scheduler_BudgetRescale();
+#endif
+#if PARTITION_ENABLE
+    Partition_ConfigureTimer();
+#endif
+}
+
+/* 정적 태스크를 리스트에 연결. TCB 필드는 컴파일 타임에 채워져 있으므로
+ * 초기 프레임만 쓰고 리스트 앞에 붙임 (스케줄러 시작 전이라 경쟁 없음) */
+static void Scheduler_LinkTaskTable(void)
+{
+    for (TCB_t *const *entry = __task_table_start; entry < __task_table_end; entry++) {
+        TCB_t *tcb = *entry;
+
+        Task_InitDefined(tcb);
+        tcb->next = taskListHead;
+        taskListHead = tcb;
+        Scheduler_TaskReady(tcb);
+    }
+}
+
 void Scheduler_Start(void)
 {
-    if (!idleTaskCreated) {
-        Task_CreateStatic(&idleTaskTCB, idleTaskStack, sizeof(idleTaskStack),
-                          IdleTask_Func, "Idle", NULL, MAX_PRIORITY_LEVELS - 1, 1);
-        idleTaskCreated = 1;
+    if (!taskTableLinked) {
+        Log_Init();
+        Scheduler_LinkTaskTable();
+        taskTableLinked = 1;
+#if GOVERNOR_ENABLE
+        Governor_Init();
+#endif
+#if LOWPOWER_STOP_ENABLE
+        LowPower_Init();
+#endif
+#if MPU_ENABLE
+        Mpu_Init();
+#endif
+#if PARTITION_ENABLE
+        Partition_Init();
+#endif
+        Sst_Init();
     }
+    BootTime_Mark(BOOT_PHASE_KERNEL_INIT);
 
     NVIC_SetPriority(PendSV_IRQn, 0xFF);
-    NVIC_SetPriority(SysTick_IRQn, 0xFE);
-    SysTick_Config(SystemCoreClock / SYSTICK_FREQ_HZ);
+    Scheduler_ConfigureTick();
 
     nextTask = Scheduler_GetHighestPriorityTask();
 
@@ -141,22 +659,19 @@ void Scheduler_Start(void)
     }
 
     nextTask->state = TASK_STATE_RUNNING;
-    currentTask = nextTask;
-
-    __asm volatile (
-        "LDR     R0, =nextTask          \n"
-        "LDR     R1, [R0]               \n"
-        "LDR     R0, [R1]               \n"
-        "LDMIA   R0!, {R4-R11}          \n"
-        "MSR     PSP, R0                \n"
-        "MRS     R0, CONTROL            \n"
-        "ORR     R0, R0, #2             \n"
-        "MSR     CONTROL, R0            \n"
-        "ISB                            \n"
-        "CPSIE   I                      \n"
-        "LDR     LR, =0xFFFFFFFD        \n"
-        "BX      LR                     \n"
-    );
+    nextTask->thresholdHeld = 1;
+#if TASK_CYCLE_ACCOUNTING
+    nextTask->runStartCycles = DWT->CYCCNT;
+#endif
+#if SCHEDULER_SLICE_CYCLES
+    Scheduler_ArmSlice(nextTask);
+#endif
+    BootTime_Mark(BOOT_PHASE_FIRST_TASK);
+
+    // 첫 태스크는 PendSV의 currentTask == NULL 경로로 로드: 예외 복귀가 하드웨어 프레임을
+    // 꺼내고 PSP/Thread mode로 전환하며, 태스크별 CONTROL.nPRIV도 같은 경로로 복원됨
+    Scheduler_ContextSwitch();
+    __enable_irq();
 
     while (1);
 }
@@ -4,13 +4,57 @@
 
 #include <stdint.h>
 #include "semaphore.h"
+#include "scheduler.h"
 
 void Semaphore_Init(Semaphore_t *sem, int32_t initialCount) {
     sem->count = initialCount;
     sem->waitListHead = NULL;
+    sem->magic = SEMAPHORE_MAGIC;
 }
 
-int 7Semaphore_Wait(Semaphore_t *sem, uint32_t timeout){
+int Semaphore_Wait(Semaphore_t *sem, uint32_t timeout){
+    int result;
 
-    return 0;
+    __disable_irq();
+
+    if (sem->count > 0) {
+        sem->count--;
+        __enable_irq();
+        return 0;
+    }
+
+    if (timeout == 0 || currentTask == NULL) {
+        __enable_irq();
+        return -1;
+    }
+
+    Task_AddToWaitList(&sem->waitListHead, currentTask, timeout);
+    __enable_irq();
+
+    Scheduler_Schedule();
+
+    // Signal이 토큰을 직접 넘겨줬으면 waitResult == 0, 타임아웃이면 아직 리스트에 남아 있음
+    __disable_irq();
+    result = currentTask->waitResult;
+    if (result != 0) {
+        Task_RemoveFromWaitList(&sem->waitListHead, currentTask);
+    }
+    __enable_irq();
+
+    return result;
+}
+
+void Semaphore_Signal(Semaphore_t *sem) {
+    TCB_t *woken;
+
+    __disable_irq();
+    woken = Task_WakeFromWaitList(&sem->waitListHead);
+    if (woken == NULL) {
+        sem->count++;
+    }
+    __enable_irq();
+
+    if (woken != NULL) {
+        Scheduler_Schedule();
+    }
 }
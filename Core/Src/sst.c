@@ -0,0 +1,134 @@
+#include "sst.h"
+
+typedef struct {
+    SstTask_t *head;
+    SstTask_t *tail;
+} SstReadyList_t;
+
+static SstReadyList_t sstReady[SST_LEVELS];
+
+static const IRQn_Type sstIrq[SST_LEVELS] = {
+    SST_LEVEL0_IRQn, SST_LEVEL1_IRQn, SST_LEVEL2_IRQn, SST_LEVEL3_IRQn
+};
+
+void Sst_Init(void)
+{
+    for (uint32_t level = 0; level < SST_LEVELS; level++) {
+        NVIC_SetPriority(sstIrq[level], SST_NVIC_PRIORITY_BASE - level);
+        NVIC_EnableIRQ(sstIrq[level]);
+    }
+}
+
+void Sst_TaskInit(SstTask_t *task, SstHandler_t handler, void *context, uint8_t level,
+                  uint32_t *eventBuffer, uint8_t capacity)
+{
+    task->handler = handler;
+    task->context = context;
+    task->events = eventBuffer;
+    task->capacity = capacity;
+    task->head = 0;
+    task->count = 0;
+    task->level = level;
+    task->queued = 0;
+    task->readyNext = NULL;
+}
+
+/* 인터럽트 비활성 상태에서 호출 */
+static void Sst_MakeReady(SstTask_t *task)
+{
+    SstReadyList_t *ready = &sstReady[task->level];
+
+    task->readyNext = NULL;
+    if (ready->tail != NULL) {
+        ready->tail->readyNext = task;
+    } else {
+        ready->head = task;
+    }
+    ready->tail = task;
+}
+
+int Sst_Post(SstTask_t *task, uint32_t event)
+{
+    uint32_t slot;
+
+    __disable_irq();
+    if (task->count >= task->capacity) {
+        __enable_irq();
+        return -1;
+    }
+
+    slot = (uint32_t)task->head + task->count;
+    if (slot >= task->capacity) {
+        slot -= task->capacity;
+    }
+    task->events[slot] = event;
+
+    task->count++;
+
+    // ready에 없고 실행 중도 아니면 올림 (실행 중이면 디스패처가 끝난 뒤 다시 올림)
+    if (!task->queued) {
+        task->queued = 1;
+        Sst_MakeReady(task);
+    }
+    __enable_irq();
+
+    NVIC_SetPendingIRQ(sstIrq[task->level]);
+    return 0;
+}
+
+/* 레벨 인터럽트 본체: ready 태스크를 하나씩 꺼내 이벤트 하나씩 처리 (같은 레벨은 라운드 로빈) */
+static void Sst_Dispatch(uint32_t level)
+{
+    SstReadyList_t *ready = &sstReady[level];
+    SstTask_t *task;
+    uint32_t event;
+
+    while (1) {
+        __disable_irq();
+        task = ready->head;
+        if (task == NULL) {
+            __enable_irq();
+            return;
+        }
+        ready->head = task->readyNext;
+        if (ready->head == NULL) {
+            ready->tail = NULL;
+        }
+
+        event = task->events[task->head];
+        task->head = (task->head + 1U == task->capacity) ? 0U : task->head + 1U;
+        task->count--;
+        __enable_irq();
+
+        task->handler(task->context, event);
+
+        // 이벤트가 남아 있으면 ready 끝에 다시 (같은 레벨의 다른 태스크 먼저)
+        __disable_irq();
+        if (task->count != 0U) {
+            Sst_MakeReady(task);
+        } else {
+            task->queued = 0;
+        }
+        __enable_irq();
+    }
+}
+
+void SST_LEVEL0_IRQHandler(void)
+{
+    Sst_Dispatch(0);
+}
+
+void SST_LEVEL1_IRQHandler(void)
+{
+    Sst_Dispatch(1);
+}
+
+void SST_LEVEL2_IRQHandler(void)
+{
+    Sst_Dispatch(2);
+}
+
+void SST_LEVEL3_IRQHandler(void)
+{
+    Sst_Dispatch(3);
+}
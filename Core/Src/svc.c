@@ -0,0 +1,205 @@
+#include "svc.h"
+#include "console.h"
+#include "scheduler.h"
+
+#define SVC_SRAM_SIZE       (128U * 1024U)  // SRAM1 + SRAM2 (연속)
+#define SVC_CCM_SIZE        (64U * 1024U)
+#define SVC_FLASH_SIZE      (1024U * 1024U)
+
+static uint32_t Svc_GetCycles(void)
+{
+    return DWT->CYCCNT;
+}
+
+/* [addr, end)가 [base, base + size) 안에 있는지 (end는 랩어라운드 검사 후) */
+static inline uint8_t Svc_InBlock(uint32_t addr, uint32_t end, uint32_t base, uint32_t size)
+{
+    return addr >= base && end - base <= size;
+}
+
+static uint8_t Svc_InRam(uint32_t addr, uint32_t end)
+{
+    return Svc_InBlock(addr, end, SRAM1_BASE, SVC_SRAM_SIZE)
+        || Svc_InBlock(addr, end, CCMDATARAM_BASE, SVC_CCM_SIZE);
+}
+
+/* 호출 태스크 전용 메모리: 스택, MPU 도메인의 일반 메모리 영역 (주변장치 영역 제외) */
+static uint8_t Svc_InCallerDomain(uint32_t addr, uint32_t end, uint8_t write)
+{
+    if (Svc_InBlock(addr, end, (uint32_t)currentTask->stackBase, currentTask->stackSize)) {
+        return 1;
+    }
+#if MPU_ENABLE
+    if (currentTask->mpuDomain != NULL) {
+        for (uint32_t i = 0; i < MPU_DOMAIN_REGIONS; i++) {
+            uint32_t rasr = currentTask->mpuDomain->regions[i].RASR;
+            uint32_t ap = (rasr & MPU_RASR_AP_Msk) >> MPU_RASR_AP_Pos;
+            uint32_t base = currentTask->mpuDomain->regions[i].RBAR & MPU_RBAR_ADDR_Msk;
+            uint32_t size = 2U << ((rasr & MPU_RASR_SIZE_Msk) >> MPU_RASR_SIZE_Pos);
+
+            if ((rasr & MPU_RASR_ENABLE_Msk) == 0U || (rasr & MPU_RASR_C_Msk) == 0U) {
+                continue;
+            }
+            if ((ap == ARM_MPU_AP_FULL || (!write && ap == ARM_MPU_AP_URO))
+                && Svc_InBlock(addr, end, base, size)) {
+                return 1;
+            }
+        }
+    }
+#endif
+    return 0;
+}
+
+/* 커널이 호출 태스크 대신 읽거나(write 0) 쓸(write 1) 범위가 그 태스크에게 허용된 곳인지 */
+static uint8_t Svc_CallerCanAccess(const void *ptr, uint32_t len, uint8_t write)
+{
+    uint32_t addr = (uint32_t)ptr;
+    uint32_t end = addr + len;
+
+    if (len == 0U) {
+        return 1;
+    }
+    if (end < addr) {
+        return 0;
+    }
+    if (Svc_InCallerDomain(addr, end, write)) {
+        return 1;
+    }
+    if (!write && Svc_InBlock(addr, end, FLASH_BASE, SVC_FLASH_SIZE)) {
+        return 1;
+    }
+#if MPU_ENABLE
+    if (currentTask->mpuDomain != NULL) {
+        return 0;
+    }
+#endif
+    // 도메인 없음: 비특권으로도 RAM 전체에 닿으므로 그 밖(주변장치, 시스템 영역)만 거부
+    return Svc_InRam(addr, end);
+}
+
+/* Init된 커널 객체인지. 호출자가 쓸 수 있는 곳의 객체는 대기 리스트 등을 위조할 수 있으므로 거부 */
+static uint8_t Svc_IsKernelObject(const void *object, uint32_t size,
+                                  const uint32_t *magic, uint32_t expected)
+{
+    uint32_t addr = (uint32_t)object;
+
+    if ((addr & 3U) != 0U || !Svc_InRam(addr, addr + size)
+        || Svc_InCallerDomain(addr, addr + size, 1)) {
+        return 0;
+    }
+    return *magic == expected;
+}
+
+#define SVC_IS_SEMAPHORE(sem)   Svc_IsKernelObject((sem), sizeof(Semaphore_t), &(sem)->magic, SEMAPHORE_MAGIC)
+#define SVC_IS_QUEUE(queue)     Svc_IsKernelObject((queue), sizeof(Queue_t), &(queue)->magic, QUEUE_MAGIC)
+#define SVC_IS_MUTEX(mutex)     Svc_IsKernelObject((mutex), sizeof(Mutex_t), &(mutex)->magic, MUTEX_MAGIC)
+
+static int Svc_UserDelayUntil(uint32_t *lastWakeTick, uint32_t period)
+{
+    if (!Svc_CallerCanAccess(lastWakeTick, sizeof(*lastWakeTick), 1)) {
+        return -1;
+    }
+    return Task_DelayUntil(lastWakeTick, period);
+}
+
+static int Svc_UserSemaphoreWait(Semaphore_t *sem, uint32_t timeout)
+{
+    if (!SVC_IS_SEMAPHORE(sem)) {
+        return -1;
+    }
+    return Semaphore_Wait(sem, timeout);
+}
+
+static void Svc_UserSemaphoreSignal(Semaphore_t *sem)
+{
+    if (SVC_IS_SEMAPHORE(sem)) {
+        Semaphore_Signal(sem);
+    }
+}
+
+static int Svc_UserQueueSend(Queue_t *queue, const void *item, uint32_t timeout)
+{
+    if (!SVC_IS_QUEUE(queue) || !Svc_CallerCanAccess(item, queue->itemSize, 0)) {
+        return -1;
+    }
+    return Queue_Send(queue, item, timeout);
+}
+
+static int Svc_UserQueueReceive(Queue_t *queue, void *item, uint32_t timeout)
+{
+    if (!SVC_IS_QUEUE(queue) || !Svc_CallerCanAccess(item, queue->itemSize, 1)) {
+        return -1;
+    }
+    return Queue_Receive(queue, item, timeout);
+}
+
+static int Svc_UserMutexLock(Mutex_t *mutex, uint32_t timeout)
+{
+    if (!SVC_IS_MUTEX(mutex)) {
+        return -1;
+    }
+    return Mutex_Lock(mutex, timeout);
+}
+
+static void Svc_UserMutexUnlock(Mutex_t *mutex)
+{
+    if (SVC_IS_MUTEX(mutex)) {
+        Mutex_Unlock(mutex);
+    }
+}
+
+static int Svc_UserConsoleWrite(const void *data, uint32_t len)
+{
+    if (!Svc_CallerCanAccess(data, len, 0)) {
+        return -1;
+    }
+    return Console_Write(data, len);
+}
+
+const SvcFunction_t svcTable[SVC_COUNT] = {
+    [SVC_TASK_DELAY]          = (SvcFunction_t)Task_Delay,
+    [SVC_TASK_YIELD]          = (SvcFunction_t)Task_Yield,
+    [SVC_TASK_GET_TICK_COUNT] = (SvcFunction_t)Task_GetTickCount,
+    [SVC_SEMAPHORE_WAIT]      = (SvcFunction_t)Semaphore_Wait,
+    [SVC_SEMAPHORE_SIGNAL]    = (SvcFunction_t)Semaphore_Signal,
+    [SVC_QUEUE_SEND]          = (SvcFunction_t)Queue_Send,
+    [SVC_QUEUE_RECEIVE]       = (SvcFunction_t)Queue_Receive,
+    [SVC_MUTEX_LOCK]          = (SvcFunction_t)Mutex_Lock,
+    [SVC_MUTEX_UNLOCK]        = (SvcFunction_t)Mutex_Unlock,
+    [SVC_CONSOLE_WRITE]       = (SvcFunction_t)Console_Write,
+    [SVC_GET_CYCLES]          = (SvcFunction_t)Svc_GetCycles,
+    [SVC_TASK_DELAY_UNTIL]    = (SvcFunction_t)Task_DelayUntil,
+    [SVC_TASK_WAIT_PERIOD]    = (SvcFunction_t)Task_WaitForNextPeriod,
+};
+
+/* 포인터/객체 인자가 없는 호출은 검사할 것이 없어 커널 함수 그대로 */
+const SvcFunction_t svcUserTable[SVC_COUNT] = {
+    [SVC_TASK_DELAY]          = (SvcFunction_t)Task_Delay,
+    [SVC_TASK_YIELD]          = (SvcFunction_t)Task_Yield,
+    [SVC_TASK_GET_TICK_COUNT] = (SvcFunction_t)Task_GetTickCount,
+    [SVC_SEMAPHORE_WAIT]      = (SvcFunction_t)Svc_UserSemaphoreWait,
+    [SVC_SEMAPHORE_SIGNAL]    = (SvcFunction_t)Svc_UserSemaphoreSignal,
+    [SVC_QUEUE_SEND]          = (SvcFunction_t)Svc_UserQueueSend,
+    [SVC_QUEUE_RECEIVE]       = (SvcFunction_t)Svc_UserQueueReceive,
+    [SVC_MUTEX_LOCK]          = (SvcFunction_t)Svc_UserMutexLock,
+    [SVC_MUTEX_UNLOCK]        = (SvcFunction_t)Svc_UserMutexUnlock,
+    [SVC_CONSOLE_WRITE]       = (SvcFunction_t)Svc_UserConsoleWrite,
+    [SVC_GET_CYCLES]          = (SvcFunction_t)Svc_GetCycles,
+    [SVC_TASK_DELAY_UNTIL]    = (SvcFunction_t)Svc_UserDelayUntil,
+    [SVC_TASK_WAIT_PERIOD]    = (SvcFunction_t)Task_WaitForNextPeriod,
+};
+
+/* 비특권 호출자의 커널 함수 실행 (SVC_Handler가 특권 Thread mode로 여기에 복귀시킴).
+ * R12 = 커널 함수, LR = svc 다음 명령, R0-R3 = 인자 */
+__attribute__((naked)) void Svc_Trampoline(void)
+{
+    __asm volatile (
+        "PUSH    {R4, LR}               \n"
+        "BLX     R12                    \n"
+        "MRS     R1, CONTROL            \n"  // 반환값(R0)은 보존
+        "ORR     R1, R1, #1             \n"
+        "MSR     CONTROL, R1            \n"  // 특권 Thread mode는 스스로 nPRIV를 세울 수 있음
+        "ISB                            \n"
+        "POP     {R4, PC}               \n"
+    );
+}
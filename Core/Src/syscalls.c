@@ -29,6 +29,8 @@
 #include <time.h>
 #include <sys/time.h>
 #include <sys/times.h>
+#include <reent.h>
+#include "svc.h"
 
 
 /* Variables */
@@ -39,6 +41,10 @@ extern int __io_getchar(void) __attribute__((weak));
 char *__env[1] = { 0 };
 char **environ = __env;
 
+/* newlib 힙/환경 변수 보호용. 인터럽트를 끄지 않고 대기 태스크는 블록됨 (ISR에서 malloc 금지) */
+static Mutex_t mallocMutex = MUTEX_INITIALIZER;
+static Mutex_t envMutex = MUTEX_INITIALIZER;
+
 
 /* Functions */
 void initialise_monitor_handles()
@@ -174,3 +180,53 @@ int _execve(char *name, char **argv, char **env)
   errno = ENOMEM;
   return -1;
 }
+
+/* 비특권 태스크는 시스템 콜로 잠금 */
+static void lock(Mutex_t *mutex)
+{
+  if (Sys_IsUnprivileged())
+  {
+    Sys_MutexLock(mutex, TASK_WAIT_FOREVER);
+  }
+  else
+  {
+    Mutex_Lock(mutex, TASK_WAIT_FOREVER);
+  }
+}
+
+static void unlock(Mutex_t *mutex)
+{
+  if (Sys_IsUnprivileged())
+  {
+    Sys_MutexUnlock(mutex);
+  }
+  else
+  {
+    Mutex_Unlock(mutex);
+  }
+}
+
+/* newlib은 malloc/free/realloc 중 재귀적으로 잠글 수 있으므로 재귀 뮤텍스 사용 */
+void __malloc_lock(struct _reent *r)
+{
+  (void)r;
+  lock(&mallocMutex);
+}
+
+void __malloc_unlock(struct _reent *r)
+{
+  (void)r;
+  unlock(&mallocMutex);
+}
+
+void __env_lock(struct _reent *r)
+{
+  (void)r;
+  lock(&envMutex);
+}
+
+void __env_unlock(struct _reent *r)
+{
+  (void)r;
+  unlock(&envMutex);
+}
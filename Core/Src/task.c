@@ -1,9 +1,13 @@
 #include "task.h"
 #include "scheduler.h"
+#include "governor.h"
+#include "workqueue.h"
 #include <string.h>
 
 #define INITIAL_XPSR  0x01000000UL
 
+static volatile uint32_t tickCount = 0;
+
 void Task_ExitError(void)
 {
     __disable_irq();
@@ -55,11 +59,19 @@ void Task_CreateStatic(TCB_t *tcb,
     tcb->name = name;
     tcb->priority = priority;
     tcb->basePriority = priority;
+    tcb->preemptThreshold = priority;
     tcb->state = TASK_STATE_READY;
     tcb->delayTicks = 0;
     tcb->timeSlice = timeSlice;
     tcb->timeSliceRemain = timeSlice;
     tcb->next = NULL;
+    tcb->waitNext = NULL;
+    tcb->waitList = NULL;
+    tcb->waitResult = 0;
+    tcb->control = 0;
+#if TASK_NEWLIB_REENT
+    _REENT_INIT_PTR(&tcb->reent);
+#endif
 
     uint32_t stackWords = stackSizeBytes / sizeof(uint32_t);
     uint32_t *stackTop = &stackBuffer[stackWords];
@@ -68,6 +80,15 @@ void Task_CreateStatic(TCB_t *tcb,
     Scheduler_AddTask(tcb);
 }
 
+void Task_InitDefined(TCB_t *tcb)
+{
+#if TASK_NEWLIB_REENT
+    _REENT_INIT_PTR(&tcb->reent);
+#endif
+    tcb->stackPointer = Task_InitStack(&tcb->stackBase[tcb->stackSize / sizeof(uint32_t)],
+                                       tcb->taskFunc, tcb->params);
+}
+
 void Task_Delay(uint32_t ticks)
 {
     if (ticks == 0) return;
@@ -76,6 +97,7 @@ void Task_Delay(uint32_t ticks)
 
     if (currentTask != NULL) {
         currentTask->delayTicks = ticks;
+        Scheduler_TaskUnready(currentTask);
         currentTask->state = TASK_STATE_BLOCKED;
     }
 
@@ -84,8 +106,131 @@ void Task_Delay(uint32_t ticks)
     Scheduler_Schedule();
 }
 
+int Task_DelayUntil(uint32_t *lastWakeTick, uint32_t period)
+{
+    int32_t remaining;
+
+    __disable_irq();
+
+    *lastWakeTick += period;
+    remaining = (int32_t)(*lastWakeTick - tickCount);
+    if (remaining <= 0) {
+        __enable_irq();
+        return -1;
+    }
+
+    if (currentTask != NULL) {
+        currentTask->delayTicks = (uint32_t)remaining;
+        Scheduler_TaskUnready(currentTask);
+        currentTask->state = TASK_STATE_BLOCKED;
+    }
+
+    __enable_irq();
+
+    Scheduler_Schedule();
+    return 0;
+}
+
+void Task_SetPeriod(TCB_t *tcb, uint32_t period, uint32_t deadline)
+{
+    __disable_irq();
+    // EDF 대상 여부와 힙 키가 바뀌므로 빼고 다시 넣음
+    Scheduler_TaskUnready(tcb);
+    tcb->period = period;
+    tcb->deadline = (deadline != 0) ? deadline : period;
+    tcb->releaseTick = tickCount;
+    tcb->jobMissed = 0;
+    if (tcb->state == TASK_STATE_READY || tcb->state == TASK_STATE_RUNNING) {
+        Scheduler_TaskReady(tcb);
+    }
+    __enable_irq();
+
+    // 실행 중인 태스크가 예산 소진으로 보류됐으면 바로 내려놓음
+    if (tcb == currentTask && tcb->state == TASK_STATE_SUSPENDED) {
+        Scheduler_Schedule();
+    }
+}
+
+/* 인터럽트 비활성 상태. 반환: 이번에 새로 미스로 판정했으면 1 */
+static uint8_t Task_CheckDeadline(TCB_t *tcb, uint32_t now)
+{
+    int32_t elapsed = (int32_t)(now - tcb->releaseTick);
+
+    // 다음 릴리스를 기다리는 중이면 elapsed < 0
+    if (tcb->period == 0 || tcb->jobMissed || elapsed < (int32_t)tcb->deadline) {
+        return 0;
+    }
+    tcb->jobMissed = 1;
+    tcb->deadlineMisses++;
+    return 1;
+}
+
+int Task_WaitForNextPeriod(void)
+{
+    TCB_t *tcb = currentTask;
+    uint8_t missed;
+    int32_t remaining;
+
+    if (tcb == NULL || tcb->period == 0) {
+        return 0;
+    }
+
+    __disable_irq();
+
+    missed = Task_CheckDeadline(tcb, tickCount);
+    Scheduler_TaskUnready(tcb);
+    tcb->releaseTick += tcb->period;
+    tcb->jobMissed = 0;
+    remaining = (int32_t)(tcb->releaseTick - tickCount);
+    if (remaining > 0) {
+        tcb->delayTicks = (uint32_t)remaining;
+        tcb->state = TASK_STATE_BLOCKED;
+    } else {
+        // 바로 다음 잡: 새 데드라인으로 다시 삽입
+        Scheduler_TaskReady(tcb);
+        tcb->overruns++;
+    }
+
+    __enable_irq();
+
+    if (missed) {
+        Task_DeadlineMissHook(tcb);
+    }
+    if (remaining <= 0) {
+        Task_OverrunHook(tcb);
+        // 다음 잡을 넣다가 예산 소진으로 보류됐으면 여기서 내려놓음
+        if (tcb->state == TASK_STATE_SUSPENDED) {
+            Scheduler_Schedule();
+        }
+        return -1;
+    }
+
+    Scheduler_Schedule();
+    return 0;
+}
+
+__attribute__((weak)) void Task_DeadlineMissHook(TCB_t *tcb)
+{
+    (void)tcb;
+}
+
+__attribute__((weak)) void Task_OverrunHook(TCB_t *tcb)
+{
+    (void)tcb;
+}
+
 void Task_Yield(void)
 {
+    if (currentTask != NULL) {
+        __disable_irq();
+        // 양보하면 임계값도 내려놓음 (다음 디스패치 때 다시 쥠)
+        currentTask->thresholdHeld = 0;
+#if SCHEDULER_SLICE_CYCLES
+        // 슬라이스가 남아 있으면 스케줄러가 교대하지 않으므로 다 쓴 것으로 처리
+        Scheduler_ExpireSlice(currentTask);
+#endif
+        __enable_irq();
+    }
     Scheduler_Schedule();
 }
 
@@ -94,24 +239,308 @@ void Task_StartScheduler(void)
     Scheduler_Start();
 }
 
+void Task_SetUnprivileged(TCB_t *tcb)
+{
+    tcb->control = CONTROL_nPRIV_Msk;
+}
+
+#if MPU_ENABLE
+void Task_SetMpuDomain(TCB_t *tcb, const MpuDomain_t *domain)
+{
+    tcb->mpuDomain = domain;
+}
+#endif
+
+#if PARTITION_ENABLE
+void Task_SetPartition(TCB_t *tcb, uint8_t partition)
+{
+    tcb->partition = partition;
+}
+#endif
+
+uint8_t Task_SetPreemptThreshold(TCB_t *tcb, uint8_t threshold)
+{
+    uint8_t old;
+
+    if (threshold > tcb->basePriority) {
+        threshold = tcb->basePriority;
+    }
+
+    __disable_irq();
+    old = tcb->preemptThreshold;
+    tcb->preemptThreshold = threshold;
+    __enable_irq();
+
+    // 임계값을 낮췄으면 그동안 막혀 있던 태스크가 선점할 수 있음
+    if (tcb == currentTask && threshold > old) {
+        Scheduler_Schedule();
+    }
+    return old;
+}
+
+#if SCHEDULER_BUDGET
+void Task_SetBudget(TCB_t *tcb, uint32_t budgetUs, uint32_t periodTicks, TaskBudgetAction_t action)
+{
+    uint8_t woke;
+
+    __disable_irq();
+    // 이전 설정의 소진 조치부터 해제
+    woke = Scheduler_BudgetRestore(tcb);
+    tcb->budgetUs = budgetUs;
+    tcb->budgetCycles = (periodTicks != 0) ? budgetUs * (SystemCoreClock / 1000000U) : 0;
+    tcb->budgetRemain = tcb->budgetCycles;
+    tcb->budgetPeriod = periodTicks;
+    tcb->budgetReplenishTick = tickCount + periodTicks;
+    tcb->budgetAction = (uint8_t)action;
+    __enable_irq();
+
+    if (woke) {
+        Scheduler_Schedule();
+    }
+}
+#endif
+
+#if SCHEDULER_FAIR
+void Task_SetWeight(TCB_t *tcb, uint16_t weight)
+{
+    if (weight == 0) {
+        weight = 1;
+    }
+
+    // 청구 때 나눗셈 대신 곱셈을 쓰도록 역수로 저장
+    __disable_irq();
+    tcb->fairInvWeight = ((uint32_t)SCHEDULER_FAIR_WEIGHT_DEFAULT << 16) / weight;
+    __enable_irq();
+}
+#endif
+
+void Task_Suspend(TCB_t *tcb)
+{
+    __disable_irq();
+    // 리스트에 남아 있으면 Signal이 SUSPENDED 태스크를 깨워 토큰을 넘겨버림.
+    // waitResult는 -1 그대로라 재개되면 타임아웃처럼 반환
+    if (tcb->waitList != NULL) {
+        Task_RemoveFromWaitList(tcb->waitList, tcb);
+    }
+    Scheduler_TaskUnready(tcb);
+    tcb->state = TASK_STATE_SUSPENDED;
+    tcb->delayTicks = 0;
+#if SCHEDULER_BUDGET
+    tcb->userSuspended = 1;
+#endif
+    __enable_irq();
+
+    if (tcb == currentTask) {
+        Scheduler_Schedule();
+    }
+}
+
+void Task_Resume(TCB_t *tcb)
+{
+    __disable_irq();
+    if (tcb->state != TASK_STATE_SUSPENDED) {
+        __enable_irq();
+        return;
+    }
+#if SCHEDULER_BUDGET
+    tcb->userSuspended = 0;
+    // 예산 소진으로도 정지돼 있으면 보충 때 Scheduler_BudgetRestore가 재개
+    if (tcb->budgetExhausted && tcb->budgetAction == TASK_BUDGET_SUSPEND) {
+        __enable_irq();
+        return;
+    }
+#endif
+    tcb->state = TASK_STATE_READY;
+    Scheduler_TaskReady(tcb);
+    __enable_irq();
+
+    // 더 높은 우선순위라면 즉시 선점
+    Scheduler_Schedule();
+}
+
+uint32_t Task_GetTickCount(void)
+{
+    return tickCount;
+}
+
+uint32_t Task_GetTicksToNextWake(void)
+{
+    // 지연 작업 만료도 깨어나야 할 시점
+    uint32_t next = WorkQueue_GetTicksToNextExpiry();
+
+    for (TCB_t *task = taskListHead; task != NULL; task = task->next) {
+        if (task->state == TASK_STATE_BLOCKED && task->delayTicks > 0
+            && task->delayTicks < next) {
+            next = task->delayTicks;
+        }
+#if SCHEDULER_BUDGET
+        // 소진 조치 중인 태스크는 보충 시각에 다시 실행 가능해짐
+        if (task->budgetExhausted) {
+            int32_t remaining = (int32_t)(task->budgetReplenishTick - tickCount);
+            uint32_t ticks = (remaining > 0) ? (uint32_t)remaining : 0;
+
+            if (ticks < next) {
+                next = ticks;
+            }
+        }
+#endif
+    }
+    return next;
+}
+
+void Task_AdvanceTicks(uint32_t ticks)
+{
+    uint8_t needSchedule = 0;
+    uint32_t primask;
+
+    if (ticks == 0) return;
+
+    // LowPower_Idle이 인터럽트를 끈 채로 부르므로 들어올 때 상태로 되돌림
+    primask = __get_PRIMASK();
+    __disable_irq();
+    tickCount += ticks;
+
+#if GOVERNOR_ENABLE
+    Governor_TickHook(1, ticks);
+#endif
+
+    for (TCB_t *task = taskListHead; task != NULL; task = task->next) {
+        if (task->state == TASK_STATE_BLOCKED && task->delayTicks > 0) {
+            if (task->delayTicks > ticks) {
+                task->delayTicks -= ticks;
+            } else {
+                task->delayTicks = 0;
+                task->state = TASK_STATE_READY;
+                Scheduler_TaskReady(task);
+                needSchedule = 1;
+            }
+        }
+        if (Task_CheckDeadline(task, tickCount)) {
+            Task_DeadlineMissHook(task);
+        }
+#if SCHEDULER_BUDGET
+        needSchedule |= Scheduler_BudgetReplenish(task, tickCount);
+#endif
+    }
+    __set_PRIMASK(primask);
+
+    WorkQueue_TickHandler();
+
+    if (needSchedule) {
+        Scheduler_Schedule();
+    }
+}
+
+/* 우선순위 순(같은 우선순위는 FIFO)으로 대기 리스트에 넣고 BLOCKED 상태로 전환 */
+void Task_AddToWaitList(TCB_t **listHead, TCB_t *tcb, uint32_t timeout)
+{
+    TCB_t **link = listHead;
+
+    while (*link != NULL && (*link)->priority <= tcb->priority) {
+        link = &(*link)->waitNext;
+    }
+    tcb->waitNext = *link;
+    *link = tcb;
+    tcb->waitList = listHead;
+
+    tcb->waitResult = -1;
+    Scheduler_TaskUnready(tcb);
+    tcb->state = TASK_STATE_BLOCKED;
+    tcb->delayTicks = (timeout == TASK_WAIT_FOREVER) ? 0 : timeout;
+}
+
+void Task_RemoveFromWaitList(TCB_t **listHead, TCB_t *tcb)
+{
+    TCB_t **link = listHead;
+
+    while (*link != NULL) {
+        if (*link == tcb) {
+            *link = tcb->waitNext;
+            break;
+        }
+        link = &(*link)->waitNext;
+    }
+    tcb->waitNext = NULL;
+    tcb->waitList = NULL;
+}
+
+/* 가장 높은 우선순위의 대기 태스크를 깨움. 깨운 태스크 반환 */
+TCB_t *Task_WakeFromWaitList(TCB_t **listHead)
+{
+    TCB_t *tcb = *listHead;
+
+    if (tcb == NULL) {
+        return NULL;
+    }
+
+    *listHead = tcb->waitNext;
+    tcb->waitNext = NULL;
+    tcb->waitList = NULL;
+    tcb->waitResult = 0;
+    tcb->delayTicks = 0;
+    tcb->state = TASK_STATE_READY;
+    Scheduler_TaskReady(tcb);
+
+    return tcb;
+}
+
 void Task_TickHandler(void)
 {
     TCB_t *task;
     uint8_t needSchedule = 0;
 
+    tickCount++;
+
+#if GOVERNOR_ENABLE
+    Governor_TickHook(Scheduler_IsIdleTask(currentTask), 1);
+#endif
+
+    WorkQueue_TickHandler();
+
     task = taskListHead;
     while (task != NULL) {
         if (task->state == TASK_STATE_BLOCKED && task->delayTicks > 0) {
             task->delayTicks--;
             if (task->delayTicks == 0) {
+                // 레디 힙은 다른 인터럽트의 깨우기와 겹치면 안 됨
+                __disable_irq();
                 task->state = TASK_STATE_READY;
+                Scheduler_TaskReady(task);
+                __enable_irq();
                 needSchedule = 1;
             }
         }
+        if (Task_CheckDeadline(task, tickCount)) {
+            Task_DeadlineMissHook(task);
+        }
+#if SCHEDULER_BUDGET
+        if (task->budgetCycles != 0) {
+            __disable_irq();
+            needSchedule |= Scheduler_BudgetReplenish(task, tickCount);
+            __enable_irq();
+        }
+#endif
         task = task->next;
     }
 
-    if (currentTask != NULL && currentTask->state == TASK_STATE_RUNNING) {
+#if SCHEDULER_FAIR || SCHEDULER_BUDGET
+    // 틱마다 청구해서 계속 도는 태스크의 예산 소진도 1틱 안에 잡음
+    if (currentTask != NULL) {
+        __disable_irq();
+        Scheduler_ChargeRunning(currentTask);
+#if SCHEDULER_BUDGET
+        if (currentTask->budgetExhausted) {
+            needSchedule = 1;
+        }
+#endif
+        __enable_irq();
+    }
+#endif
+
+#if !SCHEDULER_SLICE_CYCLES
+    // timeSlice 0 = 타임 슬라이싱 없음 (협조형)
+    if (currentTask != NULL && currentTask->state == TASK_STATE_RUNNING
+        && currentTask->timeSlice > 0) {
         if (currentTask->timeSliceRemain > 0) {
             currentTask->timeSliceRemain--;
         }
@@ -120,6 +549,7 @@ void Task_TickHandler(void)
             needSchedule = 1;
         }
     }
+#endif
 
     if (needSchedule) {
         Scheduler_Schedule();
@@ -0,0 +1,110 @@
+#include "uart_rx.h"
+#include "queue.h"
+
+#define UART_RX_MASK        (UART_RX_BUFFER_SIZE - 1U)
+
+static UART_HandleTypeDef *rxUart = NULL;
+static uint8_t rxBuffer[UART_RX_BUFFER_SIZE];
+static uint16_t rxLastPos = 0;                  // 마지막 이벤트 때 DMA 위치
+static volatile uint32_t rxProduced = 0;        // 누적 수신 바이트
+static uint32_t rxFrameStart = 0;               // 진행 중인 프레임의 시작
+static volatile uint32_t rxDroppedFrames = 0;
+
+static Queue_t rxFrameQueue;
+static UartRxFrame_t rxFrameQueueBuffer[UART_RX_FRAME_QUEUE_DEPTH];
+
+static void UartRx_Start(void)
+{
+    // DMA는 항상 인덱스 0부터 다시 시작 - 누적 카운터도 버퍼 경계에 맞춤
+    rxProduced = (rxProduced + UART_RX_MASK) & ~UART_RX_MASK;
+    rxFrameStart = rxProduced;
+    rxLastPos = 0;
+
+    // HT/TC도 켜 둠: 반 버퍼가 찰 때마다 그 절반을 태스크에 넘기고 DMA는 다른 절반을 채움
+    (void)HAL_UARTEx_ReceiveToIdle_DMA(rxUart, rxBuffer, UART_RX_BUFFER_SIZE);
+}
+
+void UartRx_Init(UART_HandleTypeDef *huart)
+{
+    rxUart = huart;
+    Queue_Init(&rxFrameQueue, rxFrameQueueBuffer, sizeof(UartRxFrame_t),
+               UART_RX_FRAME_QUEUE_DEPTH);
+    UartRx_Start();
+}
+
+int UartRx_Receive(UartRxFrame_t *frame, uint32_t timeout)
+{
+    return Queue_Receive(&rxFrameQueue, frame, timeout);
+}
+
+int UartRx_Release(const UartRxFrame_t *frame)
+{
+    uint32_t pos, live;
+
+    // 마지막 이벤트 이후 DMA가 더 쓴 양까지 포함한 현재 누적 위치
+    __disable_irq();
+    pos = UART_RX_BUFFER_SIZE - __HAL_DMA_GET_COUNTER(rxUart->hdmarx);
+    live = rxProduced + ((pos - rxLastPos) & UART_RX_MASK);
+    __enable_irq();
+
+    return (live - frame->start > UART_RX_BUFFER_SIZE) ? -1 : 0;
+}
+
+uint32_t UartRx_GetDroppedFrames(void)
+{
+    return rxDroppedFrames;
+}
+
+static void UartRx_DeliverFrame(void)
+{
+    UartRxFrame_t frame;
+    uint32_t length = rxProduced - rxFrameStart;
+    uint32_t index = rxFrameStart & UART_RX_MASK;
+    uint32_t first = UART_RX_BUFFER_SIZE - index;
+
+    if (length == 0) {
+        return;
+    }
+
+    if (length > UART_RX_BUFFER_SIZE) {
+        // 프레임이 버퍼보다 길어 앞부분이 이미 덮어써짐
+        rxDroppedFrames++;
+        rxFrameStart = rxProduced;
+        return;
+    }
+
+    if (first > length) first = length;
+    frame.start = rxFrameStart;
+    frame.data = &rxBuffer[index];
+    frame.length = (uint16_t)first;
+    frame.wrapData = rxBuffer;
+    frame.wrapLength = (uint16_t)(length - first);
+
+    if (Queue_Send(&rxFrameQueue, &frame, 0) != 0) {
+        rxDroppedFrames++;
+    }
+    rxFrameStart = rxProduced;
+}
+
+/* Size: 버퍼 내 DMA 쓰기 위치 (IDLE), 버퍼 절반 (HT), 또는 버퍼 크기 (TC) */
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size)
+{
+    if (huart != rxUart) {
+        return;
+    }
+
+    rxProduced += (uint16_t)(Size - rxLastPos);
+    rxLastPos = (Size == UART_RX_BUFFER_SIZE) ? 0 : Size;
+
+    // IDLE: 회선이 쉬어 프레임 완료. HT/TC: 반 버퍼 경계에서 끊어 전달.
+    // 스트림이 어디서 시작했든 프레임은 방금 채워진 절반 안에 있고, DMA는 다른 절반을 쓰는 중
+    UartRx_DeliverFrame();
+}
+
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+    // ORE 등으로 HAL이 DMA 수신을 중단했으면 진행 중인 프레임을 버리고 재시작
+    if (huart == rxUart && huart->RxState == HAL_UART_STATE_READY) {
+        UartRx_Start();
+    }
+}
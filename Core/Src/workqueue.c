@@ -0,0 +1,202 @@
+#include "workqueue.h"
+#include "scheduler.h"
+
+static Work_t *delayedHead = NULL;  // 만료 틱 순 정렬
+
+/* 작업 하나를 incoming에 push (다중 생산자, ISR 가능) */
+static void WorkQueue_Push(WorkQueue_t *queue, Work_t *work)
+{
+    Work_t *head;
+
+    do {
+        head = (Work_t *)__LDREXW((volatile uint32_t *)&queue->incoming);
+        work->next = head;
+    } while (__STREXW((uint32_t)work, (volatile uint32_t *)&queue->incoming) != 0U);
+
+    Semaphore_Signal(&queue->pendingCount);
+}
+
+/* incoming 전체를 떼어내 FIFO 순서로 readyHead 뒤에 붙임 (lock 보유 상태) */
+static void WorkQueue_Drain(WorkQueue_t *queue)
+{
+    Work_t *list, *reversed = NULL, **tail;
+
+    do {
+        list = (Work_t *)__LDREXW((volatile uint32_t *)&queue->incoming);
+    } while (__STREXW(0U, (volatile uint32_t *)&queue->incoming) != 0U);
+
+    while (list != NULL) {
+        Work_t *next = list->next;
+        list->next = reversed;
+        reversed = list;
+        list = next;
+    }
+
+    tail = &queue->readyHead;
+    while (*tail != NULL) {
+        tail = &(*tail)->next;
+    }
+    *tail = reversed;
+}
+
+static void WorkQueue_WorkerFunc(void *params)
+{
+    WorkQueue_t *queue = (WorkQueue_t *)params;
+    Work_t *work;
+
+    while (1) {
+        Semaphore_Wait(&queue->pendingCount, TASK_WAIT_FOREVER);
+
+        Mutex_Lock(&queue->lock, TASK_WAIT_FOREVER);
+        if (queue->readyHead == NULL) {
+            WorkQueue_Drain(queue);
+        }
+        work = queue->readyHead;
+        if (work != NULL) {
+            queue->readyHead = work->next;
+        }
+        Mutex_Unlock(&queue->lock);
+
+        if (work != NULL) {
+            // 실행 전에 해제: 핸들러가 자기 자신을 다시 제출할 수 있음
+            work->pending = 0;
+            work->handler(work->context);
+        }
+    }
+}
+
+void WorkQueue_Init(WorkQueue_t *queue)
+{
+    queue->incoming = NULL;
+    queue->readyHead = NULL;
+    Mutex_Init(&queue->lock);
+    Semaphore_Init(&queue->pendingCount, 0);
+}
+
+void WorkQueue_StartWorker(WorkQueue_t *queue, TCB_t *tcb, uint32_t *stack,
+                           uint32_t stackSizeBytes, const char *name, uint8_t priority)
+{
+    Task_CreateStatic(tcb, stack, stackSizeBytes, WorkQueue_WorkerFunc, name, queue,
+                      priority, 0);
+}
+
+void Work_Init(Work_t *work, WorkHandler_t handler, void *context)
+{
+    work->next = NULL;
+    work->handler = handler;
+    work->context = context;
+    work->pending = 0;
+    work->delayed = 0;
+    work->queue = NULL;
+    work->expiry = 0;
+}
+
+/* pending 0 -> 1. 이미 1이면 0 반환 */
+static int Work_Claim(Work_t *work)
+{
+    do {
+        if (__LDREXW(&work->pending) != 0U) {
+            __CLREX();
+            return 0;
+        }
+    } while (__STREXW(1U, &work->pending) != 0U);
+
+    return 1;
+}
+
+int Work_Submit(WorkQueue_t *queue, Work_t *work)
+{
+    if (!Work_Claim(work)) {
+        return 0;
+    }
+
+    WorkQueue_Push(queue, work);
+    return 1;
+}
+
+int Work_SubmitDelayed(WorkQueue_t *queue, Work_t *work, uint32_t ticks)
+{
+    Work_t **link;
+
+    if (ticks == 0) {
+        return Work_Submit(queue, work);
+    }
+    if (!Work_Claim(work)) {
+        return 0;
+    }
+
+    work->queue = queue;
+
+    __disable_irq();
+    work->expiry = Task_GetTickCount() + ticks;
+    work->delayed = 1;
+
+    link = &delayedHead;
+    while (*link != NULL && (int32_t)((*link)->expiry - work->expiry) <= 0) {
+        link = &(*link)->next;
+    }
+    work->next = *link;
+    *link = work;
+    __enable_irq();
+
+    return 1;
+}
+
+int Work_CancelDelayed(Work_t *work)
+{
+    Work_t **link;
+
+    __disable_irq();
+    if (!work->delayed) {
+        __enable_irq();
+        return 0;
+    }
+
+    for (link = &delayedHead; *link != NULL; link = &(*link)->next) {
+        if (*link == work) {
+            *link = work->next;
+            break;
+        }
+    }
+    work->delayed = 0;
+    work->next = NULL;
+    work->pending = 0;
+    __enable_irq();
+
+    return 1;
+}
+
+void WorkQueue_TickHandler(void)
+{
+    uint32_t now = Task_GetTickCount();
+    Work_t *work;
+
+    while (1) {
+        __disable_irq();
+        work = delayedHead;
+        if (work == NULL || (int32_t)(now - work->expiry) < 0) {
+            __enable_irq();
+            break;
+        }
+        delayedHead = work->next;
+        work->delayed = 0;
+        __enable_irq();
+
+        // pending은 SubmitDelayed에서 이미 잡아둠
+        WorkQueue_Push(work->queue, work);
+    }
+}
+
+uint32_t WorkQueue_GetTicksToNextExpiry(void)
+{
+    uint32_t now = Task_GetTickCount();
+    Work_t *head = delayedHead;
+
+    if (head == NULL) {
+        return TASK_WAIT_FOREVER;
+    }
+    if ((int32_t)(head->expiry - now) <= 0) {
+        return 1;
+    }
+    return head->expiry - now;
+}
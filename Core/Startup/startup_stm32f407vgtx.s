@@ -54,47 +54,95 @@ defined in linker script */
  * @retval : None
 */
 
+/* bootStamps[phase] = DWT->CYCCNT (boottime.h, phase = BootPhase_t index) */
+.macro BOOT_MARK phase
+  ldr r0, =0xE0001004    /* DWT->CYCCNT */
+  ldr r0, [r0]
+  ldr r1, =bootStamps
+  str r0, [r1, #(\phase * 4)]
+.endm
+
     .section  .text.Reset_Handler
   .weak  Reset_Handler
   .type  Reset_Handler, %function
 Reset_Handler:  
   ldr   sp, =_estack     /* set stack pointer */
 
-/* Copy the data segment initializers from flash to SRAM */  
+/* Boot-phase timer (boottime.h): run DWT->CYCCNT from 0 at reset */
+  ldr   r0, =0xE000EDFC  /* CoreDebug->DEMCR */
+  ldr   r1, [r0]
+  orr   r1, r1, #0x01000000  /* TRCENA */
+  str   r1, [r0]
+  ldr   r0, =0xE0001000  /* DWT->CTRL */
+  movs  r1, #0
+  str   r1, [r0, #4]     /* DWT->CYCCNT = 0 */
+  ldr   r1, [r0]
+  orr   r1, r1, #1       /* CYCCNTENA */
+  str   r1, [r0]
+
+/* Copy the data segment initializers from flash to SRAM,
+   16 bytes per LDM/STM pair, then the remaining words */
   ldr r0, =_sdata
   ldr r1, =_edata
   ldr r2, =_sidata
-  movs r3, #0
+  subs r3, r1, r0
+  bic r3, r3, #15
+  adds r3, r0, r3        /* end of the 16-byte blocks */
+  b LoopCopyDataBlock
+
+CopyDataBlock:
+  ldmia r2!, {r4-r7}
+  stmia r0!, {r4-r7}
+
+LoopCopyDataBlock:
+  cmp r0, r3
+  bcc CopyDataBlock
   b LoopCopyDataInit
 
 CopyDataInit:
-  ldr r4, [r2, r3]
-  str r4, [r0, r3]
-  adds r3, r3, #4
+  ldr r4, [r2], #4
+  str r4, [r0], #4
 
 LoopCopyDataInit:
-  adds r4, r0, r3
-  cmp r4, r1
+  cmp r0, r1
   bcc CopyDataInit
+  BOOT_MARK 0            /* BOOT_PHASE_DATA_COPY */
   
-/* Zero fill the bss segment. */
+/* Zero fill the bss segment, 16 bytes per STM, then the remaining words.
+   Stacks and trace buffers live in .noinit and are skipped */
   ldr r2, =_sbss
   ldr r4, =_ebss
-  movs r3, #0
+  subs r3, r4, r2
+  bic r3, r3, #15
+  adds r3, r2, r3        /* end of the 16-byte blocks */
+  movs r5, #0
+  movs r6, #0
+  movs r7, #0
+  mov r8, r5
+  b LoopFillZeroBlock
+
+FillZeroBlock:
+  stmia r2!, {r5-r8}
+
+LoopFillZeroBlock:
+  cmp r2, r3
+  bcc FillZeroBlock
   b LoopFillZerobss
 
 FillZerobss:
-  str  r3, [r2]
-  adds r2, r2, #4
+  str  r5, [r2], #4
 
 LoopFillZerobss:
   cmp r2, r4
   bcc FillZerobss
+  BOOT_MARK 1            /* BOOT_PHASE_BSS_ZERO */
 
 /* Call the clock system initialization function.*/
   bl  SystemInit   
+  BOOT_MARK 2            /* BOOT_PHASE_SYSTEM_INIT */
 /* Call static constructors */
     bl __libc_init_array
+  BOOT_MARK 3            /* BOOT_PHASE_CONSTRUCTORS */
 /* Call the application's entry point.*/
   bl  main
   bx  lr    
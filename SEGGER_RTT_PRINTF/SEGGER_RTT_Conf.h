@@ -80,7 +80,7 @@ Revision: $Rev: 24316 $
 // Up-channel 1: SystemView
 //
 #ifndef   SEGGER_RTT_MAX_NUM_UP_BUFFERS
-  #define SEGGER_RTT_MAX_NUM_UP_BUFFERS             (3)     // Max. number of up-buffers (T->H) available on this target    (Default: 3)
+  #define SEGGER_RTT_MAX_NUM_UP_BUFFERS             (8)     // 0: terminal, 1: log, 2..7: RttChannel_Open() (Default: 3)
 #endif
 //
 // Most common case:
@@ -99,6 +99,10 @@ Revision: $Rev: 24316 $
   #define BUFFER_SIZE_DOWN                          (16)    // Size of the buffer for terminal input to target from host (Usually keyboard input) (Default: 16)
 #endif
 
+#ifndef   SEGGER_RTT_BUFFER_SECTION
+  #define SEGGER_RTT_BUFFER_SECTION                 ".noinit" // Terminal up/down buffers are not zeroed by the startup code (linker script .noinit)
+#endif
+
 #ifndef   SEGGER_RTT_PRINTF_BUFFER_SIZE
   #define SEGGER_RTT_PRINTF_BUFFER_SIZE             (64u)    // Size of buffer for RTT printf to bulk-send chars via RTT     (Default: 64)
 #endif
@@ -144,7 +148,10 @@ Revision: $Rev: 24316 $
 // or define SEGGER_RTT_LOCK() to completely disable interrupts.
 //
 #ifndef   SEGGER_RTT_MAX_INTERRUPT_PRIORITY
-  #define SEGGER_RTT_MAX_INTERRUPT_PRIORITY         (0x20)   // Interrupt priority to lock on SEGGER_RTT_LOCK on Cortex-M3/4 (Default: 0x20)
+  // Only NVIC priorities 6..15 (kernel ticks, PendSV and RTT-writing ISRs) are masked while
+  // a locked RTT write copies data; priorities 0..5 (UART/DMA, TIM) are never delayed by it.
+  // Channels opened with RttChannel_Open() bypass this lock entirely.
+  #define SEGGER_RTT_MAX_INTERRUPT_PRIORITY         (0x60)   // Interrupt priority to lock on SEGGER_RTT_LOCK on Cortex-M3/4 (Default: 0x20)
 #endif
 
 /*********************************************************************
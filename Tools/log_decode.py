@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+"""Decode deferred binary log records (Core/Inc/log.h, LOG_BACKEND_RTT).
+
+Usage:
+    log_decode.py RTOS.elf rtt_channel1.bin [--hz 168000000]
+
+The record stream is the raw content of RTT up-buffer 1 ("Log"), e.g.
+captured with `JLinkRTTLogger -RTTChannel 1`. Format strings are read from
+the .log_fmt section of the ELF; %s arguments are looked up in the ELF
+image by address.
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+SLOT_FORMAT = "<8I"
+SLOT_SIZE = struct.calcsize(SLOT_FORMAT)
+LEVELS = "DIWE"
+CONVERSION = re.compile(r"%([-+ #0]*\d*(?:\.\d+)?)(?:hh|h|ll|l|z|t|j)?([diouxXcsp%])")
+
+
+class Elf32:
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        if self.data[:4] != b"\x7fELF" or self.data[4] != 1:
+            raise ValueError("not an ELF32 file")
+        (shoff,) = struct.unpack_from("<I", self.data, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from("<HHH", self.data, 0x2E)
+        headers = [struct.unpack_from("<10I", self.data, shoff + i * shentsize)
+                   for i in range(shnum)]
+        strtab = headers[shstrndx]
+        self.sections = {}
+        for h in headers:
+            name_end = self.data.index(b"\0", strtab[4] + h[0])
+            name = self.data[strtab[4] + h[0]:name_end].decode()
+            # (addr, offset, size, type)
+            self.sections[name] = (h[3], h[4], h[5], h[1])
+
+    def section(self, name):
+        addr, offset, size, _ = self.sections[name]
+        return addr, self.data[offset:offset + size]
+
+    def string_at(self, address):
+        for addr, offset, size, sh_type in self.sections.values():
+            if sh_type == 1 and addr <= address < addr + size:  # SHT_PROGBITS
+                start = offset + address - addr
+                return self.data[start:self.data.index(b"\0", start)].decode(errors="replace")
+        return "<0x%08x>" % address
+
+
+def c_format(fmt, args, elf):
+    values = iter(args)
+
+    def convert(match):
+        flags, conv = match.group(1), match.group(2)
+        if conv == "%":
+            return "%"
+        value = next(values, 0)
+        if conv == "s":
+            return ("%" + flags + "s") % elf.string_at(value)
+        if conv == "p":
+            return "0x%08x" % value
+        if conv in "di":
+            value = value - (1 << 32) if value & 0x80000000 else value
+            conv = "d"
+        if conv == "c":
+            value = chr(value & 0xFF)
+        return ("%" + flags + conv) % value
+
+    return CONVERSION.sub(convert, fmt)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("elf")
+    parser.add_argument("records", nargs="?", help="binary record file (default: stdin)")
+    parser.add_argument("--hz", type=int, default=168000000, help="core clock for timestamps")
+    opts = parser.parse_args()
+
+    elf = Elf32(opts.elf)
+    _, strings = elf.section(".log_fmt")
+    stream = open(opts.records, "rb") if opts.records else sys.stdin.buffer
+
+    while True:
+        record = stream.read(SLOT_SIZE)
+        if len(record) < SLOT_SIZE:
+            break
+        meta, timestamp, *args = struct.unpack(SLOT_FORMAT, record)
+        fmt_id = meta & 0xFFFF
+        nargs = (meta >> 16) & 0x7
+        level = LEVELS[(meta >> 20) & 0x3]
+        fmt = strings[fmt_id:strings.index(b"\0", fmt_id)].decode(errors="replace")
+        print("[%12.6f] %s %s" % (timestamp / opts.hz, level, c_format(fmt, args[:nargs], elf)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+"""Check that the C++ wrappers (Core/Inc/rtos.hpp) cost nothing over the C API.
+
+Usage:
+    wrapper_size.py [--cxx arm-none-eabi-g++] [--opt=-Os] [--cflags="..."]
+
+Compiles the same worker written against the C API and against rtos.hpp,
+then compares per-function code size from nm. Exits 1 if any function in
+the wrapper build is larger than its C counterpart.
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+import tempfile
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+C_API = r"""
+#include "task.h"
+#include "semaphore.h"
+#include "queue.h"
+#include "mutex.h"
+struct Msg { uint32_t id, value; };
+static TCB_t tcb;
+static uint32_t stack[128] __attribute__((aligned(8)));
+static Queue_t queue;
+static Msg queueBuffer[8];
+static Mutex_t mutex = MUTEX_INITIALIZER;
+static Semaphore_t done;
+static uint32_t total;
+void init() {
+    Queue_Init(&queue, queueBuffer, sizeof(Msg), 8);
+    Semaphore_Init(&done, 0);
+}
+void worker(void *) {
+    Msg msg;
+    for (;;) {
+        if (Queue_Receive(&queue, &msg, TASK_WAIT_FOREVER) == 0) {
+            Mutex_Lock(&mutex, TASK_WAIT_FOREVER);
+            total += msg.value;
+            Mutex_Unlock(&mutex);
+            Semaphore_Signal(&done);
+        }
+    }
+}
+void start() { Task_CreateStatic(&tcb, stack, sizeof(stack), worker, "w", nullptr, 1, 0); }
+"""
+
+WRAPPER = r"""
+#include "rtos.hpp"
+struct Msg { uint32_t id, value; };
+static rtos::StaticTask<128> task;
+static rtos::Queue<Msg, 8> queue;
+static rtos::Mutex mutex;
+static rtos::Semaphore done;
+static uint32_t total;
+void worker(void *) {
+    Msg msg;
+    for (;;) {
+        if (queue.receive(msg)) {
+            rtos::LockGuard guard(mutex);
+            total += msg.value;
+            done.signal();
+        }
+    }
+}
+void start() { task.start(worker, "w", nullptr, 1); }
+"""
+
+
+def compile_sizes(cxx, opt, cflags, source, workdir, name):
+    src = os.path.join(workdir, name + ".cpp")
+    obj = os.path.join(workdir, name + ".o")
+    with open(src, "w") as f:
+        f.write(source)
+    includes = ["Core/Inc", "Drivers/STM32F4xx_HAL_Driver/Inc",
+                "Drivers/CMSIS/Device/ST/STM32F4xx/Include", "Drivers/CMSIS/Include"]
+    cmd = [cxx, "-c", opt, "-std=c++20", "-fno-exceptions", "-fno-rtti",
+           "-DSTM32F407xx", "-DUSE_HAL_DRIVER"]
+    if "arm" in os.path.basename(cxx):
+        cmd += ["-mcpu=cortex-m4", "-mthumb"]
+    cmd += ["-I" + os.path.join(ROOT, inc) for inc in includes] + cflags
+    subprocess.run(cmd + [src, "-o", obj], check=True)
+
+    nm = cxx[:-3] + "nm" if cxx.endswith("g++") else "nm"
+    out = subprocess.run([nm, "-S", "-C", "--defined-only", obj],
+                         check=True, capture_output=True, text=True).stdout
+    sizes = {}
+    for line in out.splitlines():
+        parts = line.split(None, 3)
+        if len(parts) == 4 and parts[2] in "tT":
+            sizes[parts[3]] = int(parts[1], 16)
+    return sizes
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--cxx", default="arm-none-eabi-g++")
+    parser.add_argument("--opt", default="-Os")
+    parser.add_argument("--cflags", default="", help="extra compiler flags")
+    args = parser.parse_args()
+
+    with tempfile.TemporaryDirectory() as workdir:
+        c_sizes = compile_sizes(args.cxx, args.opt, args.cflags.split(), C_API, workdir, "c_api")
+        w_sizes = compile_sizes(args.cxx, args.opt, args.cflags.split(), WRAPPER, workdir, "wrapper")
+
+    # Queue/Semaphore init lives in init() for C and in a static constructor for C++
+    c_sizes["<static init>"] = c_sizes.pop("init()", 0)
+    w_sizes["<static init>"] = sum(v for k, v in list(w_sizes.items()) if "_GLOBAL__sub_I" in k)
+
+    failed = False
+    for func in ("worker(void*)", "start()", "<static init>"):
+        c, w = c_sizes.get(func, 0), w_sizes.get(func, 0)
+        mark = "" if w <= c else "  <-- larger"
+        failed |= w > c
+        print(f"{func:16} c_api={c:4} wrapper={w:4}{mark}")
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())